@@ -34,6 +34,7 @@ import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5F_LIBVER_LATEST;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5F_SCOPE_GLOBAL;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5O_TYPE_GROUP;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5P_ATTRIBUTE_CREATE;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5P_DATASET_ACCESS;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5P_DATASET_CREATE;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5P_DEFAULT;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5P_FILE_ACCESS;
@@ -59,23 +60,35 @@ import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_STD_I32LE;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_STD_I8LE;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_STR_NULLPAD;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_VARIABLE;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5Z_FLAG_MANDATORY;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5Z_SO_FLOAT_DSCALE;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5Z_SO_INT;
 
 import java.io.File;
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.FloatBuffer;
+import java.nio.IntBuffer;
+import java.nio.LongBuffer;
+import java.nio.ShortBuffer;
 import java.util.Arrays;
 import java.util.LinkedList;
 import java.util.List;
+import java.util.concurrent.CopyOnWriteArrayList;
 
 import ncsa.hdf.hdf5lib.exceptions.HDF5Exception;
 import ncsa.hdf.hdf5lib.exceptions.HDF5JavaException;
 
 import ch.systemsx.cisd.base.mdarray.MDAbstractArray;
+import ch.systemsx.cisd.hdf5.HDF5AbstractStorageFeatures.FilterCompression;
 import ch.systemsx.cisd.hdf5.IHDF5WriterConfigurator.FileFormat;
 import ch.systemsx.cisd.hdf5.cleanup.CleanUpCallable;
 import ch.systemsx.cisd.hdf5.cleanup.CleanUpRegistry;
 import ch.systemsx.cisd.hdf5.cleanup.ICallableWithCleanUp;
 import ch.systemsx.cisd.hdf5.cleanup.ICleanUpRegistry;
+import ch.systemsx.cisd.hdf5.hdf5lib.H5Features;
 import ch.systemsx.cisd.hdf5.hdf5lib.HDFNativeData;
 
 /**
@@ -89,6 +102,9 @@ class HDF5
 
     private final static int MAX_PATH_LENGTH = 16384;
 
+    /** The minimum size the metadata cache may shrink to (the library default). */
+    private static final long MIN_META_DATA_CACHE_SIZE = 1024 * 1024;
+
     private final CleanUpCallable runner;
 
     private final int dataSetCreationPropertyListCompactStorageLayoutFileTimeAlloc;
@@ -103,11 +119,40 @@ class HDF5
 
     private final boolean autoDereference;
 
+    private final HDF5DataSetIdCache dataSetIdCache;
+
+    private final HDF5ChunkCacheParameters chunkCacheOrNull;
+
+    private final HDF5FileAccessParameters fileAccessParametersOrNull;
+
+    private final List<Runnable> linkChangeListeners = new CopyOnWriteArrayList<Runnable>();
+
+    private final List<IObjectAccessListener> objectAccessListeners =
+            new CopyOnWriteArrayList<IObjectAccessListener>();
+
+    /**
+     * A listener that is called before an object of the file is opened, copied, moved or deleted.
+     */
+    interface IObjectAccessListener
+    {
+        /**
+         * Called before the object <var>path</var> is accessed. The <var>path</var> is
+         * <code>"/"</code> if the object is accessed by reference.
+         */
+        void objectAccessed(String path);
+    }
+
     public HDF5(final CleanUpRegistry fileRegistry, final CleanUpCallable runner,
             final boolean performNumericConversions, final boolean useUTF8CharEncoding,
-            final boolean autoDereference)
+            final boolean autoDereference, final HDF5ChunkCacheParameters chunkCacheOrNull,
+            final HDF5FileAccessParameters fileAccessParametersOrNull)
     {
         this.runner = runner;
+        this.chunkCacheOrNull = chunkCacheOrNull;
+        this.fileAccessParametersOrNull =
+                (fileAccessParametersOrNull == null || fileAccessParametersOrNull.isDefault())
+                        ? null : fileAccessParametersOrNull;
+        this.dataSetIdCache = new HDF5DataSetIdCache();
         this.useUTF8CharEncoding = useUTF8CharEncoding;
         this.autoDereference = autoDereference;
         this.dataSetCreationPropertyListCompactStorageLayoutFileTimeAlloc =
@@ -160,7 +205,7 @@ class HDF5
     private int createFileAccessPropertyListId(boolean enforce_1_8, ICleanUpRegistry registry)
     {
         int fileAccessPropertyListId = H5P_DEFAULT;
-        if (enforce_1_8)
+        if (enforce_1_8 || chunkCacheOrNull != null || fileAccessParametersOrNull != null)
         {
             final int fapl = H5Pcreate(H5P_FILE_ACCESS);
             registry.registerCleanUp(new Runnable()
@@ -171,15 +216,74 @@ class HDF5
                         H5Pclose(fapl);
                     }
                 });
-            H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST);
+            if (enforce_1_8)
+            {
+                H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST);
+            }
+            if (chunkCacheOrNull != null)
+            {
+                // The number of elements in the meta data cache is ignored since 1.8.0.
+                H5Pset_cache(fapl, 0, chunkCacheOrNull.getNumberOfSlots(),
+                        chunkCacheOrNull.getSizeInBytes(), chunkCacheOrNull.getPreemptionPolicy());
+            }
+            if (fileAccessParametersOrNull != null)
+            {
+                if (fileAccessParametersOrNull.isInMemory())
+                {
+                    H5Pset_fapl_core(fapl, fileAccessParametersOrNull.getInMemoryIncrement(),
+                            fileAccessParametersOrNull.isBackingStore());
+                }
+                if (fileAccessParametersOrNull.getSmallDataBlockSize() >= 0)
+                {
+                    H5Pset_small_data_block_size(fapl,
+                            fileAccessParametersOrNull.getSmallDataBlockSize());
+                }
+                if (fileAccessParametersOrNull.getAlignment() >= 0)
+                {
+                    H5Pset_alignment(fapl, fileAccessParametersOrNull.getAlignmentThreshold(),
+                            fileAccessParametersOrNull.getAlignment());
+                }
+                if (fileAccessParametersOrNull.getMetaBlockSize() >= 0)
+                {
+                    if (H5Features.isMetaBlockSizeAvailable() == false)
+                    {
+                        throw new HDF5JavaException("The native library doesn't support "
+                                + "setting the metadata block size (H5Pset_meta_block_size "
+                                + "is missing).");
+                    }
+                    H5Pset_meta_block_size(fapl, fileAccessParametersOrNull.getMetaBlockSize());
+                }
+                if (fileAccessParametersOrNull.getMetaDataCacheSize() >= 0)
+                {
+                    if (H5Features.isMetaDataCacheConfigAvailable() == false)
+                    {
+                        throw new HDF5JavaException("The native library doesn't support "
+                                + "setting the metadata cache size (H5Pset_mdc_config is "
+                                + "missing).");
+                    }
+                    final long size = fileAccessParametersOrNull.getMetaDataCacheSize();
+                    H5Pset_mdc_config(fapl, size, Math.min(size, MIN_META_DATA_CACHE_SIZE),
+                            size);
+                }
+            }
             fileAccessPropertyListId = fapl;
         }
         return fileAccessPropertyListId;
     }
 
+    /**
+     * Returns the parameters of the file access property list, or <code>null</code>, if the
+     * library defaults are used.
+     */
+    public HDF5FileAccessParameters tryGetFileAccessParameters()
+    {
+        return fileAccessParametersOrNull;
+    }
+
     public int openFileReadOnly(String fileName, ICleanUpRegistry registry)
     {
-        final int fileId = H5Fopen(fileName, H5F_ACC_RDONLY, H5P_DEFAULT);
+        final int fileAccessPropertyListId = createFileAccessPropertyListId(false, registry);
+        final int fileId = H5Fopen(fileName, H5F_ACC_RDONLY, fileAccessPropertyListId);
         registry.registerCleanUp(new Runnable()
             {
                 @Override
@@ -224,6 +328,7 @@ class HDF5
     public int openObject(int fileId, String path, ICleanUpRegistry registry)
     {
         checkMaxLength(path);
+        fireObjectAccessed(path);
         final int objectId =
                 isReference(path) ? H5Rdereference(fileId, Long.parseLong(path.substring(1)))
                         : H5Oopen(fileId, path, H5P_DEFAULT);
@@ -241,6 +346,9 @@ class HDF5
     public int deleteObject(int fileId, String path)
     {
         checkMaxLength(path);
+        fireObjectAccessed(path);
+        dataSetIdCache.invalidate();
+        fireLinksChanged();
         final int success = H5Gunlink(fileId, path);
         return success;
     }
@@ -249,6 +357,7 @@ class HDF5
     {
         checkMaxLength(srcPath);
         checkMaxLength(dstPath);
+        fireObjectAccessed(srcPath);
         final int success =
                 H5Ocopy(srcFileId, srcPath, dstFileId, dstPath, H5P_DEFAULT, H5P_DEFAULT);
         return success;
@@ -258,6 +367,9 @@ class HDF5
     {
         checkMaxLength(srcLinkPath);
         checkMaxLength(dstLinkPath);
+        fireObjectAccessed(srcLinkPath);
+        dataSetIdCache.invalidate();
+        fireLinksChanged();
         final int success =
                 H5Lmove(fileId, srcLinkPath, fileId, dstLinkPath, lcplCreateIntermediateGroups,
                         H5P_DEFAULT);
@@ -619,6 +731,7 @@ class HDF5
             {
                 setDeflate(dataSetCreationPropertyListId, compression.getDeflateLevel());
             }
+            setFilterCompression(dataSetCreationPropertyListId, compression);
         } else if (layout == HDF5StorageLayout.COMPACT)
         {
             dataSetCreationPropertyListId =
@@ -627,9 +740,24 @@ class HDF5
         {
             dataSetCreationPropertyListId = dataSetCreationPropertyListFillTimeAlloc;
         }
-        final int dataSetId =
-                H5Dcreate(fileId, dataSetName, dataTypeId, dataSpaceId,
-                        lcplCreateIntermediateGroups, dataSetCreationPropertyListId, H5P_DEFAULT);
+        final boolean chunked = (layout == HDF5StorageLayout.CHUNKED && chunkSizeOrNull != null);
+        final String filterPluginOrNull = chunked ? tryGetFilterPlugin(compression) : null;
+        final int dataSetId;
+        try
+        {
+            dataSetId =
+                    H5Dcreate(fileId, dataSetName, dataTypeId, dataSpaceId,
+                            lcplCreateIntermediateGroups, dataSetCreationPropertyListId,
+                            H5P_DEFAULT);
+        } catch (HDF5Exception ex)
+        {
+            // The library loads filter plugins lazily, so a missing plugin shows up here.
+            if (filterPluginOrNull == null)
+            {
+                throw ex;
+            }
+            throw createFilterPluginNotAvailableException(filterPluginOrNull, ex);
+        }
         registry.registerCleanUp(new Runnable()
             {
                 @Override
@@ -679,6 +807,7 @@ class HDF5
             {
                 setDeflate(dataSetCreationPropertyListId, compression.getDeflateLevel());
             }
+            setFilterCompression(dataSetCreationPropertyListId, compression);
         } else if (layout == HDF5StorageLayout.COMPACT)
         {
             dataSetCreationPropertyListId =
@@ -750,6 +879,22 @@ class HDF5
         }
     }
 
+    /**
+     * Returns the chunk dimensions of the data set <var>dataSetId</var>, or <code>null</code>, if
+     * it is not chunked.
+     */
+    public long[] tryGetChunkDimensions(int dataSetId, ICleanUpRegistry registry)
+    {
+        final int dataSetCreationPropertyListId = getCreationPropertyList(dataSetId, registry);
+        if (H5Pget_layout(dataSetCreationPropertyListId) != H5D_CHUNKED)
+        {
+            return null;
+        }
+        final long[] chunkDimensions = new long[H5S_MAX_RANK];
+        final int rank = H5Pget_chunk(dataSetCreationPropertyListId, H5S_MAX_RANK, chunkDimensions);
+        return Arrays.copyOf(chunkDimensions, rank);
+    }
+
     private int getCreationPropertyList(int dataSetId, ICleanUpRegistry registry)
     {
         final int dataSetCreationPropertyListId = H5Dget_create_plist(dataSetId);
@@ -798,6 +943,90 @@ class HDF5
         H5Pset_deflate(dscpId, deflateLevel);
     }
 
+    private void setFilterCompression(int dscpId, HDF5AbstractStorageFeatures compression)
+    {
+        assert dscpId >= 0;
+
+        final FilterCompression filterCompressionOrNull = compression.tryGetFilterCompression();
+        if (compression.isBitshuffle())
+        {
+            // Element size and block size are filled in by the filter, the fifth value selects
+            // the compression done by the filter: 0 - none, 2 - LZ4, 3 - Zstandard.
+            final int[] cdValues;
+            if (filterCompressionOrNull == FilterCompression.LZ4)
+            {
+                cdValues = new int[]
+                    { 0, 0, 0, 0, 2 };
+            } else if (filterCompressionOrNull == FilterCompression.ZSTD)
+            {
+                cdValues = new int[]
+                    { 0, 0, 0, 0, 3, compression.getFilterCompressionLevel() };
+            } else
+            {
+                cdValues = new int[]
+                    { 0, 0, 0, 0, 0 };
+            }
+            setFilter(dscpId, HDF5AbstractStorageFeatures.BITSHUFFLE_FILTER_ID, "bitshuffle",
+                    cdValues);
+        } else if (filterCompressionOrNull == FilterCompression.LZ4)
+        {
+            // A block size of 0 selects the default block size of the filter.
+            setFilter(dscpId, filterCompressionOrNull.getFilterId(), "LZ4", new int[]
+                { 0 });
+        } else if (filterCompressionOrNull == FilterCompression.ZSTD)
+        {
+            setFilter(dscpId, filterCompressionOrNull.getFilterId(), "Zstandard", new int[]
+                { compression.getFilterCompressionLevel() });
+        }
+    }
+
+    private void setFilter(int dscpId, int filterId, String filterName, int[] cdValues)
+    {
+        try
+        {
+            H5Pset_filter(dscpId, filterId, H5Z_FLAG_MANDATORY, cdValues.length, cdValues);
+        } catch (HDF5Exception ex)
+        {
+            throw createFilterPluginNotAvailableException(getFilterPlugin(filterName, filterId),
+                    ex);
+        }
+    }
+
+    /**
+     * Returns a description of the filter plugin that <var>compression</var> needs, or
+     * <code>null</code>, if it only needs built-in filters. If both bitshuffle and another plugin
+     * are needed, bitshuffle is returned as it comes first in the filter pipeline.
+     */
+    private static String tryGetFilterPlugin(HDF5AbstractStorageFeatures compression)
+    {
+        if (compression.isBitshuffle())
+        {
+            return getFilterPlugin("bitshuffle", HDF5AbstractStorageFeatures.BITSHUFFLE_FILTER_ID);
+        }
+        final FilterCompression filterCompressionOrNull = compression.tryGetFilterCompression();
+        if (filterCompressionOrNull == FilterCompression.LZ4)
+        {
+            return getFilterPlugin("LZ4", filterCompressionOrNull.getFilterId());
+        } else if (filterCompressionOrNull == FilterCompression.ZSTD)
+        {
+            return getFilterPlugin("Zstandard", filterCompressionOrNull.getFilterId());
+        }
+        return null;
+    }
+
+    private static String getFilterPlugin(String filterName, int filterId)
+    {
+        return "The " + filterName + " filter plugin (id " + filterId + ")";
+    }
+
+    private static HDF5JavaException createFilterPluginNotAvailableException(
+            String filterPlugin, HDF5Exception cause)
+    {
+        return new HDF5JavaException(filterPlugin
+                + " is not available. Check that HDF5_PLUGIN_PATH points to it. ("
+                + cause.getMessage() + ")");
+    }
+
     public int createScalarDataSet(int fileId, int dataTypeId, String dataSetName,
             boolean compactLayout, ICleanUpRegistry registry)
     {
@@ -831,9 +1060,18 @@ class HDF5
         return dataSetId;
     }
 
+    /**
+     * Opens the data set <var>path</var>. If <var>registry</var> is not <code>null</code>, the id
+     * is taken from the data set id cache and must not be closed by the caller.
+     */
     public int openDataSet(int fileId, String path, ICleanUpRegistry registry)
     {
         checkMaxLength(path);
+        fireObjectAccessed(path);
+        if (registry != null && isReference(path) == false)
+        {
+            return dataSetIdCache.open(fileId, path, registry);
+        }
         final int dataSetId =
                 isReference(path) ? H5Rdereference(fileId, Long.parseLong(path.substring(1)))
                         : H5Dopen(fileId, path, H5P_DEFAULT);
@@ -851,6 +1089,125 @@ class HDF5
         return dataSetId;
     }
 
+    /**
+     * Returns <code>true</code>, if the native library can write encoded chunks, bypassing the
+     * filter pipeline.
+     */
+    public boolean isWriteChunkRawSupported()
+    {
+        return H5Features.isWriteChunkAvailable();
+    }
+
+    /**
+     * Writes the already encoded chunk <var>chunkBytes</var> at <var>chunkOffset</var> of the data
+     * set <var>dataSetId</var>, bypassing the filter pipeline.
+     *
+     * @throws HDF5JavaException If the native library doesn't provide
+     *             <code>H5DOwrite_chunk</code>.
+     */
+    public void writeChunkRaw(int dataSetId, long[] chunkOffset, int filterMask, byte[] chunkBytes)
+    {
+        if (isWriteChunkRawSupported() == false)
+        {
+            throw new HDF5JavaException("The native library doesn't support writing raw chunks "
+                    + "(H5DOwrite_chunk is missing).");
+        }
+        H5DOwrite_chunk(dataSetId, H5P_DEFAULT, filterMask, chunkOffset, chunkBytes.length,
+                chunkBytes);
+    }
+
+    /**
+     * Opens the data set <var>path</var> with its own chunk cache as given by
+     * <var>chunkCache</var>. The id is never taken from the data set id cache.
+     *
+     * @throws HDF5JavaException If the native library doesn't provide
+     *             <code>H5Pset_chunk_cache</code>.
+     */
+    public int openDataSet(int fileId, String path, HDF5ChunkCacheParameters chunkCache,
+            ICleanUpRegistry registry)
+    {
+        checkMaxLength(path);
+        fireObjectAccessed(path);
+        if (H5Features.isDataSetChunkCacheAvailable() == false)
+        {
+            throw new HDF5JavaException("The native library doesn't support a chunk cache per "
+                    + "data set (H5Pset_chunk_cache is missing). Set the chunk cache of the "
+                    + "file with the chunkCache() method of the configurator instead.");
+        }
+        final int dataSetAccessPropertyListId = H5Pcreate(H5P_DATASET_ACCESS);
+        final int dataSetId;
+        try
+        {
+            H5Pset_chunk_cache(dataSetAccessPropertyListId, chunkCache.getNumberOfSlots(),
+                    chunkCache.getSizeInBytes(), chunkCache.getPreemptionPolicy());
+            dataSetId =
+                    isReference(path) ? H5Rdereference(fileId, Long.parseLong(path.substring(1)))
+                            : H5Dopen(fileId, path, dataSetAccessPropertyListId);
+        } finally
+        {
+            H5Pclose(dataSetAccessPropertyListId);
+        }
+        if (registry != null)
+        {
+            registry.registerCleanUp(new Runnable()
+                {
+                    @Override
+                    public void run()
+                    {
+                        H5Dclose(dataSetId);
+                    }
+                });
+        }
+        return dataSetId;
+    }
+
+    /**
+     * Adds a <var>listener</var> that is called whenever links of the file are deleted or moved,
+     * e.g. to clear a cache that is keyed by path.
+     */
+    void addLinkChangeListener(Runnable listener)
+    {
+        linkChangeListeners.add(listener);
+    }
+
+    private void fireLinksChanged()
+    {
+        for (Runnable listener : linkChangeListeners)
+        {
+            listener.run();
+        }
+    }
+
+    /**
+     * Adds a <var>listener</var> that is called before an object of the file is opened, copied,
+     * moved or deleted, e.g. to write data that are kept in memory for it.
+     */
+    void addObjectAccessListener(IObjectAccessListener listener)
+    {
+        objectAccessListeners.add(listener);
+    }
+
+    /**
+     * Notifies the listeners that the object <var>path</var> is accessed. Needs to be called on
+     * every access through a handle that has been opened before.
+     */
+    void fireObjectAccessed(String path)
+    {
+        final String objectPath = isReference(path) ? "/" : path;
+        for (IObjectAccessListener listener : objectAccessListeners)
+        {
+            listener.objectAccessed(objectPath);
+        }
+    }
+
+    /**
+     * Closes all cached data set ids. Needs to be called before the file is closed.
+     */
+    void invalidateDataSetIdCache()
+    {
+        dataSetIdCache.invalidate();
+    }
+
     boolean isReference(String path)
     {
         return autoDereference && (path.charAt(0) == '\0');
@@ -864,6 +1221,7 @@ class HDF5
             throws HDF5JavaException
     {
         checkMaxLength(path);
+        fireObjectAccessed(path);
         final int dataSetId =
                 isReference(path) ? H5Rdereference(fileId, Long.parseLong(path.substring(1)))
                         : H5Dopen(fileId, path, H5P_DEFAULT);
@@ -1073,6 +1431,218 @@ class HDF5
                 numericConversionXferPropertyListID, data);
     }
 
+    public void readDataSet(int dataSetId, int nativeDataTypeId, int memorySpaceId,
+            int fileSpaceId, ByteBuffer data)
+    {
+        if (canReadDirectly(data, ByteOrder.nativeOrder()))
+        {
+            H5Dread(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId,
+                    numericConversionXferPropertyListID, data.slice());
+        } else
+        {
+            final byte[] array = new byte[getTransferLength(memorySpaceId, data)];
+            readDataSet(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, array);
+            data.duplicate().put(array);
+        }
+    }
+
+    public void readDataSet(int dataSetId, int nativeDataTypeId, int memorySpaceId,
+            int fileSpaceId, ShortBuffer data)
+    {
+        if (canReadDirectly(data, data.order()))
+        {
+            H5Dread(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId,
+                    numericConversionXferPropertyListID, data.slice());
+        } else
+        {
+            final short[] array = new short[getTransferLength(memorySpaceId, data)];
+            readDataSet(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, array);
+            data.duplicate().put(array);
+        }
+    }
+
+    public void readDataSet(int dataSetId, int nativeDataTypeId, int memorySpaceId,
+            int fileSpaceId, IntBuffer data)
+    {
+        if (canReadDirectly(data, data.order()))
+        {
+            H5Dread(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId,
+                    numericConversionXferPropertyListID, data.slice());
+        } else
+        {
+            final int[] array = new int[getTransferLength(memorySpaceId, data)];
+            readDataSet(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, array);
+            data.duplicate().put(array);
+        }
+    }
+
+    public void readDataSet(int dataSetId, int nativeDataTypeId, int memorySpaceId,
+            int fileSpaceId, LongBuffer data)
+    {
+        if (canReadDirectly(data, data.order()))
+        {
+            H5Dread(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId,
+                    numericConversionXferPropertyListID, data.slice());
+        } else
+        {
+            final long[] array = new long[getTransferLength(memorySpaceId, data)];
+            readDataSet(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, array);
+            data.duplicate().put(array);
+        }
+    }
+
+    public void readDataSet(int dataSetId, int nativeDataTypeId, int memorySpaceId,
+            int fileSpaceId, FloatBuffer data)
+    {
+        if (canReadDirectly(data, data.order()))
+        {
+            H5Dread(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId,
+                    numericConversionXferPropertyListID, data.slice());
+        } else
+        {
+            final float[] array = new float[getTransferLength(memorySpaceId, data)];
+            readDataSet(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, array);
+            data.duplicate().put(array);
+        }
+    }
+
+    public void readDataSet(int dataSetId, int nativeDataTypeId, int memorySpaceId,
+            int fileSpaceId, DoubleBuffer data)
+    {
+        if (canReadDirectly(data, data.order()))
+        {
+            H5Dread(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId,
+                    numericConversionXferPropertyListID, data.slice());
+        } else
+        {
+            final double[] array = new double[getTransferLength(memorySpaceId, data)];
+            readDataSet(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, array);
+            data.duplicate().put(array);
+        }
+    }
+
+    public void writeDataSet(int dataSetId, int nativeDataTypeId, int memorySpaceId,
+            int fileSpaceId, ByteBuffer data)
+    {
+        if (canWriteDirectly(data, ByteOrder.nativeOrder()))
+        {
+            H5Dwrite(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, H5P_DEFAULT,
+                    data.slice());
+        } else
+        {
+            final byte[] array = new byte[getTransferLength(memorySpaceId, data)];
+            data.duplicate().get(array);
+            H5Dwrite(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, H5P_DEFAULT, array);
+        }
+    }
+
+    public void writeDataSet(int dataSetId, int nativeDataTypeId, int memorySpaceId,
+            int fileSpaceId, ShortBuffer data)
+    {
+        if (canWriteDirectly(data, data.order()))
+        {
+            H5Dwrite(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, H5P_DEFAULT,
+                    data.slice());
+        } else
+        {
+            final short[] array = new short[getTransferLength(memorySpaceId, data)];
+            data.duplicate().get(array);
+            H5Dwrite(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, H5P_DEFAULT, array);
+        }
+    }
+
+    public void writeDataSet(int dataSetId, int nativeDataTypeId, int memorySpaceId,
+            int fileSpaceId, IntBuffer data)
+    {
+        if (canWriteDirectly(data, data.order()))
+        {
+            H5Dwrite(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, H5P_DEFAULT,
+                    data.slice());
+        } else
+        {
+            final int[] array = new int[getTransferLength(memorySpaceId, data)];
+            data.duplicate().get(array);
+            H5Dwrite(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, H5P_DEFAULT, array);
+        }
+    }
+
+    public void writeDataSet(int dataSetId, int nativeDataTypeId, int memorySpaceId,
+            int fileSpaceId, LongBuffer data)
+    {
+        if (canWriteDirectly(data, data.order()))
+        {
+            H5Dwrite(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, H5P_DEFAULT,
+                    data.slice());
+        } else
+        {
+            final long[] array = new long[getTransferLength(memorySpaceId, data)];
+            data.duplicate().get(array);
+            H5Dwrite(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, H5P_DEFAULT, array);
+        }
+    }
+
+    public void writeDataSet(int dataSetId, int nativeDataTypeId, int memorySpaceId,
+            int fileSpaceId, FloatBuffer data)
+    {
+        if (canWriteDirectly(data, data.order()))
+        {
+            H5Dwrite(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, H5P_DEFAULT,
+                    data.slice());
+        } else
+        {
+            final float[] array = new float[getTransferLength(memorySpaceId, data)];
+            data.duplicate().get(array);
+            H5Dwrite(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, H5P_DEFAULT, array);
+        }
+    }
+
+    public void writeDataSet(int dataSetId, int nativeDataTypeId, int memorySpaceId,
+            int fileSpaceId, DoubleBuffer data)
+    {
+        if (canWriteDirectly(data, data.order()))
+        {
+            H5Dwrite(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, H5P_DEFAULT,
+                    data.slice());
+        } else
+        {
+            final double[] array = new double[getTransferLength(memorySpaceId, data)];
+            data.duplicate().get(array);
+            H5Dwrite(dataSetId, nativeDataTypeId, memorySpaceId, fileSpaceId, H5P_DEFAULT, array);
+        }
+    }
+
+    /**
+     * Returns <code>true</code>, if data can be read into <var>buffer</var> without an
+     * intermediate Java array. This needs a direct buffer in native byte order and a native library
+     * that can read into buffers.
+     */
+    private static boolean canReadDirectly(Buffer buffer, ByteOrder byteOrder)
+    {
+        return buffer.isDirect() && byteOrder == ByteOrder.nativeOrder()
+                && H5Features.isBufferReadAvailable();
+    }
+
+    /**
+     * Returns <code>true</code>, if data can be written from <var>buffer</var> without an
+     * intermediate Java array. This needs a direct buffer in native byte order and a native library
+     * that can write from buffers.
+     */
+    private static boolean canWriteDirectly(Buffer buffer, ByteOrder byteOrder)
+    {
+        return buffer.isDirect() && byteOrder == ByteOrder.nativeOrder()
+                && H5Features.isBufferWriteAvailable();
+    }
+
+    /**
+     * Returns the number of elements transferred between the memory space
+     * <var>memorySpaceId</var> and <var>buffer</var>.
+     */
+    private static int getTransferLength(int memorySpaceId, Buffer buffer)
+    {
+        return (memorySpaceId == H5S_ALL) ? buffer.remaining()
+                : (int) H5Sget_select_npoints(memorySpaceId);
+    }
+
     public void readDataSetVL(int dataSetId, int dataTypeId, String[] data)
     {
         H5DreadVL(dataSetId, dataTypeId, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
@@ -1817,6 +2387,23 @@ class HDF5
         }
     }
 
+    /**
+     * Releases the variable-length members of the records in <var>buf</var>. If
+     * <var>arenaOrNull</var> is not <code>null</code>, <var>buf</var> has been byteified using this
+     * arena and the arena is released instead.
+     */
+    public void reclaimCompoundVL(HDF5CompoundType<?> type, byte[] buf,
+            HDF5VLStringArena arenaOrNull)
+    {
+        if (arenaOrNull != null)
+        {
+            arenaOrNull.release();
+        } else
+        {
+            reclaimCompoundVL(type, buf);
+        }
+    }
+
     //
     // Data Space
     //
@@ -75,6 +75,96 @@ abstract class HDF5AbstractStorageFeatures
         ENFORCE_REPLACE_WITH_NEW
     }
 
+    /**
+     * The default compression level of the Zstandard filter.
+     */
+    public final static byte DEFAULT_ZSTD_LEVEL = 3;
+
+    /**
+     * The minimal compression level of the Zstandard filter.
+     */
+    public final static byte MIN_ZSTD_LEVEL = 1;
+
+    /**
+     * The maximal compression level of the Zstandard filter.
+     */
+    public final static byte MAX_ZSTD_LEVEL = 22;
+
+    /**
+     * A fast compression filter that is not built into the HDF5 library but provided as a plugin
+     * with a filter id registered with the HDF Group.
+     * <p>
+     * The plugin needs to be available when a data set is created and when its data are read, e.g.
+     * by pointing the environment variable <code>HDF5_PLUGIN_PATH</code> to the directory that
+     * holds it. Without the plugin, a file can still be opened and its metadata can be read.
+     */
+    public enum FilterCompression
+    {
+        /** The LZ4 filter. */
+        LZ4(32004),
+
+        /** The Zstandard filter. */
+        ZSTD(32015);
+
+        private final int filterId;
+
+        private FilterCompression(int filterId)
+        {
+            this.filterId = filterId;
+        }
+
+        /**
+         * Returns the registered id of this filter.
+         */
+        public int getFilterId()
+        {
+            return filterId;
+        }
+    }
+
+    /**
+     * A hint on how the data of a data set will be accessed, used to choose the shape of its chunks
+     * when no chunk size is given explicitly.
+     */
+    public enum ChunkAccessPattern
+    {
+        /**
+         * Blocks that extend in all dimensions. Chunks are shrunk along their largest dimension
+         * first, which gives chunks of about equal extent in all dimensions.
+         */
+        TILES,
+
+        /**
+         * Scans along the last dimension, e.g. reading a matrix row by row. Chunks keep the full
+         * extent of the last dimensions and are shrunk along the first dimensions first.
+         */
+        ROW_SCAN,
+
+        /**
+         * Scans along the first dimension, e.g. reading a matrix column by column. Chunks keep the
+         * full extent of the first dimensions and are shrunk along the last dimensions first.
+         */
+        COLUMN_SCAN,
+
+        /**
+         * Appending along the first dimension. Like {@link #ROW_SCAN}, but the first dimension of
+         * the chunks is filled up to the target chunk size even if the data set is smaller, so
+         * that appended data go into chunks of the target size.
+         */
+        APPEND_ALONG_FIRST_AXIS
+    }
+
+    /**
+     * The default size in bytes that chunks are planned to have, if the data set does not fit into
+     * one chunk of this size.
+     */
+    public final static int DEFAULT_CHUNK_TARGET_SIZE = 1024 * 1024;
+
+    /**
+     * The registered id of the bitshuffle filter.
+     */
+    final static int BITSHUFFLE_FILTER_ID = 32008;
+
     /**
      * Do not perform any scaling on the data.
      */
@@ -100,6 +190,16 @@ abstract class HDF5AbstractStorageFeatures
 
     private final boolean shuffleBeforeDeflate;
 
+    private final FilterCompression filterCompressionOrNull;
+
+    private final byte filterCompressionLevel;
+
+    private final boolean bitshuffle;
+
+    private final ChunkAccessPattern chunkAccessPattern;
+
+    private final int chunkTargetSize;
+
     public abstract static class HDF5AbstractStorageFeatureBuilder
     {
         private byte deflateLevel;
@@ -113,6 +213,16 @@ abstract class HDF5AbstractStorageFeatures
 
         private boolean shuffleBeforeDeflate;
 
+        private FilterCompression filterCompressionOrNull;
+
+        private byte filterCompressionLevel;
+
+        private boolean bitshuffle;
+
+        private ChunkAccessPattern chunkAccessPattern = ChunkAccessPattern.TILES;
+
+        private int chunkTargetSize = DEFAULT_CHUNK_TARGET_SIZE;
+
         HDF5AbstractStorageFeatureBuilder()
         {
         }
@@ -124,6 +234,11 @@ abstract class HDF5AbstractStorageFeatures
             storageLayout(template.tryGetProposedLayout());
             datasetReplacementPolicy(template.getDatasetReplacementPolicy());
             shuffleBeforeDeflate(template.isShuffleBeforeDeflate());
+            filterCompressionOrNull = template.tryGetFilterCompression();
+            filterCompressionLevel = template.getFilterCompressionLevel();
+            bitshuffle(template.isBitshuffle());
+            chunkAccessPattern(template.getChunkAccessPattern());
+            chunkTargetSize(template.getChunkTargetSize());
         }
 
         byte getDeflateLevel()
@@ -151,6 +266,31 @@ abstract class HDF5AbstractStorageFeatures
             return shuffleBeforeDeflate;
         }
 
+        FilterCompression tryGetFilterCompression()
+        {
+            return filterCompressionOrNull;
+        }
+
+        byte getFilterCompressionLevel()
+        {
+            return filterCompressionLevel;
+        }
+
+        boolean isBitshuffle()
+        {
+            return bitshuffle;
+        }
+
+        ChunkAccessPattern getChunkAccessPattern()
+        {
+            return chunkAccessPattern;
+        }
+
+        int getChunkTargetSize()
+        {
+            return chunkTargetSize;
+        }
+
         public HDF5AbstractStorageFeatureBuilder compress(boolean compress)
         {
             this.deflateLevel = compress ? DEFAULT_DEFLATION_LEVEL : NO_DEFLATION_LEVEL;
@@ -195,7 +335,51 @@ abstract class HDF5AbstractStorageFeatures
 
         public HDF5AbstractStorageFeatureBuilder noShuffleBeforeDeflate()
         {
-            this.shuffleBeforeDeflate = true;
+            this.shuffleBeforeDeflate = false;
+            return this;
+        }
+
+        public HDF5AbstractStorageFeatureBuilder lz4()
+        {
+            this.filterCompressionOrNull = FilterCompression.LZ4;
+            this.filterCompressionLevel = 0;
+            return this;
+        }
+
+        public HDF5AbstractStorageFeatureBuilder zstd()
+        {
+            return zstd(DEFAULT_ZSTD_LEVEL);
+        }
+
+        public HDF5AbstractStorageFeatureBuilder zstd(byte zstdLevel)
+        {
+            this.filterCompressionOrNull = FilterCompression.ZSTD;
+            this.filterCompressionLevel = zstdLevel;
+            return this;
+        }
+
+        public HDF5AbstractStorageFeatureBuilder bitshuffle(boolean bitshuffle)
+        {
+            this.bitshuffle = bitshuffle;
+            return this;
+        }
+
+        public HDF5AbstractStorageFeatureBuilder bitshuffle()
+        {
+            this.bitshuffle = true;
+            return this;
+        }
+
+        public HDF5AbstractStorageFeatureBuilder chunkAccessPattern(
+                ChunkAccessPattern chunkAccessPattern)
+        {
+            this.chunkAccessPattern = chunkAccessPattern;
+            return this;
+        }
+
+        public HDF5AbstractStorageFeatureBuilder chunkTargetSize(int chunkTargetSize)
+        {
+            this.chunkTargetSize = chunkTargetSize;
             return this;
         }
 
@@ -267,16 +451,80 @@ abstract class HDF5AbstractStorageFeatures
     HDF5AbstractStorageFeatures(final HDF5StorageLayout proposedLayoutOrNull,
             final DataSetReplacementPolicy datasetReplacementPolicy,
             final boolean shuffleBeforeDeflate, final byte deflateLevel, final byte scalingFactor)
+    {
+        this(proposedLayoutOrNull, datasetReplacementPolicy, shuffleBeforeDeflate, deflateLevel,
+                scalingFactor, null, (byte) 0, false, ChunkAccessPattern.TILES,
+                DEFAULT_CHUNK_TARGET_SIZE);
+    }
+
+    HDF5AbstractStorageFeatures(final HDF5AbstractStorageFeatureBuilder builder)
+    {
+        this(builder.getStorageLayout(), builder.getDatasetReplacementPolicy(), builder
+                .isShuffleBeforeDeflate(), builder.getDeflateLevel(), builder.getScalingFactor(),
+                builder.tryGetFilterCompression(), builder.getFilterCompressionLevel(), builder
+                        .isBitshuffle(), builder.getChunkAccessPattern(), builder
+                        .getChunkTargetSize());
+    }
+
+    HDF5AbstractStorageFeatures(final HDF5StorageLayout proposedLayoutOrNull,
+            final DataSetReplacementPolicy datasetReplacementPolicy,
+            final boolean shuffleBeforeDeflate, final byte deflateLevel, final byte scalingFactor,
+            final FilterCompression filterCompressionOrNull, final byte filterCompressionLevel,
+            final boolean bitshuffle, final ChunkAccessPattern chunkAccessPattern,
+            final int chunkTargetSize)
     {
         if (deflateLevel < 0)
         {
             throw new IllegalArgumentException("Invalid deflateLevel " + deflateLevel);
         }
+        if (filterCompressionOrNull != null && deflateLevel != NO_DEFLATION_LEVEL)
+        {
+            throw new IllegalArgumentException("Deflation cannot be combined with "
+                    + filterCompressionOrNull + " compression.");
+        }
+        if (filterCompressionOrNull == FilterCompression.ZSTD
+                && (filterCompressionLevel < MIN_ZSTD_LEVEL
+                        || filterCompressionLevel > MAX_ZSTD_LEVEL))
+        {
+            throw new IllegalArgumentException("Invalid zstdLevel " + filterCompressionLevel
+                    + " (needs to be between " + MIN_ZSTD_LEVEL + " and " + MAX_ZSTD_LEVEL + ")");
+        }
+        if (bitshuffle)
+        {
+            // Bitshuffle comes last in the filter pipeline, after these filters have run.
+            if (deflateLevel != NO_DEFLATION_LEVEL)
+            {
+                throw new IllegalArgumentException(
+                        "Bitshuffle cannot be combined with deflation.");
+            }
+            if (shuffleBeforeDeflate)
+            {
+                throw new IllegalArgumentException(
+                        "Bitshuffle cannot be combined with shuffling.");
+            }
+            if (scalingFactor >= 0)
+            {
+                throw new IllegalArgumentException("Bitshuffle cannot be combined with scaling.");
+            }
+        }
+        if (chunkAccessPattern == null)
+        {
+            throw new IllegalArgumentException("Chunk access pattern must not be null.");
+        }
+        if (chunkTargetSize <= 0)
+        {
+            throw new IllegalArgumentException("Invalid chunkTargetSize " + chunkTargetSize);
+        }
         this.proposedLayoutOrNull = proposedLayoutOrNull;
         this.datasetReplacementPolicy = datasetReplacementPolicy;
         this.shuffleBeforeDeflate = shuffleBeforeDeflate;
         this.deflateLevel = deflateLevel;
         this.scalingFactor = scalingFactor;
+        this.filterCompressionOrNull = filterCompressionOrNull;
+        this.filterCompressionLevel = filterCompressionLevel;
+        this.bitshuffle = bitshuffle;
+        this.chunkAccessPattern = chunkAccessPattern;
+        this.chunkTargetSize = chunkTargetSize;
     }
 
     /**
@@ -304,7 +552,8 @@ abstract class HDF5AbstractStorageFeatures
 
     boolean requiresChunking()
     {
-        return isDeflating() || isScaling() || proposedLayoutOrNull == HDF5StorageLayout.CHUNKED;
+        return isDeflating() || isScaling() || isFilterCompressing() || bitshuffle
+                || proposedLayoutOrNull == HDF5StorageLayout.CHUNKED;
     }
 
     boolean allowsCompact()
@@ -354,6 +603,58 @@ abstract class HDF5AbstractStorageFeatures
         return deflateLevel;
     }
 
+    /**
+     * Returns <code>true</code>, if this storage feature object compresses data with one of the
+     * {@link FilterCompression} plugin filters.
+     */
+    public boolean isFilterCompressing()
+    {
+        return filterCompressionOrNull != null;
+    }
+
+    /**
+     * Returns the plugin filter that this storage feature object compresses data with, or
+     * <code>null</code>, if it doesn't use one.
+     */
+    public FilterCompression tryGetFilterCompression()
+    {
+        return filterCompressionOrNull;
+    }
+
+    /**
+     * Returns the compression level of the plugin filter. Only meaningful for
+     * {@link FilterCompression#ZSTD}.
+     */
+    public byte getFilterCompressionLevel()
+    {
+        return filterCompressionLevel;
+    }
+
+    /**
+     * Returns <code>true</code>, if this storage feature object performs a bitshuffle before
+     * compressing the data.
+     */
+    public boolean isBitshuffle()
+    {
+        return bitshuffle;
+    }
+
+    /**
+     * Returns the access pattern that the chunk shape is planned for.
+     */
+    public ChunkAccessPattern getChunkAccessPattern()
+    {
+        return chunkAccessPattern;
+    }
+
+    /**
+     * Returns the size in bytes that chunks are planned to have.
+     */
+    public int getChunkTargetSize()
+    {
+        return chunkTargetSize;
+    }
+
     /**
      * Returns the scaling factor of this storage feature object. -1 means no scaling, 0 means
      * auto-scaling.
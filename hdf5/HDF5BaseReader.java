@@ -22,6 +22,7 @@ import static ch.systemsx.cisd.hdf5.HDF5Utils.createObjectTypeVariantAttributeNa
 import static ch.systemsx.cisd.hdf5.HDF5Utils.getBooleanDataTypePath;
 import static ch.systemsx.cisd.hdf5.HDF5Utils.getDataTypeGroup;
 import static ch.systemsx.cisd.hdf5.HDF5Utils.getOneDimensionalArraySize;
+import static ch.systemsx.cisd.hdf5.HDF5Utils.getStringDictionaryAttributeName;
 import static ch.systemsx.cisd.hdf5.HDF5Utils.getTypeVariantDataTypePath;
 import static ch.systemsx.cisd.hdf5.HDF5Utils.getTypeVariantMembersAttributeName;
 import static ch.systemsx.cisd.hdf5.HDF5Utils.getVariableLengthStringDataTypePath;
@@ -29,6 +30,7 @@ import static ch.systemsx.cisd.hdf5.HDF5Utils.removeInternalNames;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5S_ALL;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_ARRAY;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_ENUM;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_INTEGER;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_NATIVE_INT32;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_STRING;
 
@@ -79,6 +81,9 @@ class HDF5BaseReader
 
     protected final boolean performNumericConversions;
 
+    /** Whether compound records of a mismatched layout are converted in Java. */
+    final boolean convertCompoundsInJava;
+
     /** Map from named data types to ids. */
     private final Map<String, Integer> namedDataTypeMap;
 
@@ -97,6 +102,9 @@ class HDF5BaseReader
 
     private final List<DataTypeContainer> namedDataTypeList;
 
+    /** Cache of compound types inferred from Java classes. */
+    final HDF5CompoundTypeCache compoundTypeCache;
+
     protected final HDF5 h5;
 
     protected final int fileId;
@@ -123,27 +131,40 @@ class HDF5BaseReader
             FileFormat fileFormat, boolean overwrite, String preferredHouseKeepingNameSuffix)
     {
         this(hdf5File, performNumericConversions, false, autoDereference, fileFormat, overwrite,
-                preferredHouseKeepingNameSuffix);
+                preferredHouseKeepingNameSuffix, null, null, false);
     }
 
     HDF5BaseReader(File hdf5File, boolean performNumericConversions, boolean useUTF8CharEncoding,
             boolean autoDereference, FileFormat fileFormat, boolean overwrite,
-            String preferredHouseKeepingNameSuffix)
+            String preferredHouseKeepingNameSuffix, HDF5ChunkCacheParameters chunkCacheOrNull,
+            HDF5FileAccessParameters fileAccessParametersOrNull, boolean convertCompoundsInJava)
     {
         assert hdf5File != null;
         assert preferredHouseKeepingNameSuffix != null;
 
         this.performNumericConversions = performNumericConversions;
+        this.convertCompoundsInJava = convertCompoundsInJava;
         this.hdf5File = hdf5File.getAbsoluteFile();
         this.runner = new CleanUpCallable();
         this.fileRegistry = CleanUpRegistry.createSynchonized();
         this.namedDataTypeMap = new HashMap<String, Integer>();
         this.namedDataTypeList = new ArrayList<DataTypeContainer>();
+        this.compoundTypeCache = new HDF5CompoundTypeCache();
         this.encodingForNewDataSets =
                 useUTF8CharEncoding ? CharacterEncoding.UTF8 : CharacterEncoding.ASCII;
         this.h5 =
                 new HDF5(fileRegistry, runner, performNumericConversions, useUTF8CharEncoding,
-                        autoDereference);
+                        autoDereference, chunkCacheOrNull, fileAccessParametersOrNull);
+        final HDF5CompoundTypeCache typeCache = compoundTypeCache;
+        h5.addLinkChangeListener(new Runnable()
+            {
+                @Override
+                public void run()
+                {
+                    // Compound types are keyed by data set and data type path.
+                    typeCache.clear();
+                }
+            });
         this.fileId = openFile(fileFormat, overwrite);
         this.state = State.OPEN;
 
@@ -229,6 +250,8 @@ class HDF5BaseReader
         {
             if (state == State.OPEN)
             {
+                compoundTypeCache.clear();
+                h5.invalidateDataSetIdCache();
                 fileRegistry.cleanUp(false);
             }
             state = State.CLOSED;
@@ -269,6 +292,12 @@ class HDF5BaseReader
     }
 
     public HDF5DataSet openDataSet(final String objectPath)
+    {
+        return openDataSet(objectPath, null);
+    }
+
+    public HDF5DataSet openDataSet(final String objectPath,
+            final HDF5ChunkCacheParameters chunkCacheOrNull)
     {
         final ICallableWithCleanUp<HDF5DataSet> openDataSetCallable =
                 new ICallableWithCleanUp<HDF5DataSet>()
@@ -276,15 +305,18 @@ class HDF5BaseReader
                         @Override
                         public HDF5DataSet call(ICleanUpRegistry registry)
                         {
-                            final int dataSetId = h5.openDataSet(fileId, objectPath, null);
+                            final int dataSetId =
+                                    (chunkCacheOrNull == null) ? h5.openDataSet(fileId,
+                                            objectPath, null) : h5.openDataSet(fileId, objectPath,
+                                            chunkCacheOrNull, null);
                             final HDF5StorageLayout layout = h5.getLayout(dataSetId, registry);
                             final int dataSpaceId = h5.getDataSpaceForDataSet(dataSetId, null);
                             final long[] dimensions = h5.getDataSpaceDimensions(dataSpaceId);
                             final long[] maxDimensions =
                                     h5.getDataMaxDimensions(dataSetId, registry);
                             final HDF5DataSet dataSet =
-                                    new HDF5DataSet(objectPath, dataSetId, dataSpaceId, dimensions,
-                                            maxDimensions, layout);
+                                    new HDF5DataSet(h5, objectPath, dataSetId, dataSpaceId,
+                                            dimensions, maxDimensions, layout);
                             fileRegistry.registerCleanUp(new Runnable()
                                 {
                                     @Override
@@ -360,6 +392,7 @@ class HDF5BaseReader
 
     void renameNamedDataType(String oldPath, String newPath)
     {
+        compoundTypeCache.clear();
         final Integer typeIdOrNull = namedDataTypeMap.remove(oldPath);
         if (typeIdOrNull != null)
         {
@@ -564,6 +597,64 @@ class HDF5BaseReader
         return new DataSpaceParameters(memorySpaceId, dataSpaceId, effectiveBlockSize, dimensions);
     }
 
+    /**
+     * Returns the {@link DataSpaceParameters} for reading a 1d block of the given
+     * <var>dataSetId</var> into a buffer of <var>bufferLength</var> elements, starting at
+     * <var>memoryOffset</var> of the buffer.
+     */
+    DataSpaceParameters getBufferSpaceParameters(final int dataSetId, final long offset,
+            final int blockSize, final int bufferLength, final int memoryOffset,
+            ICleanUpRegistry registry)
+    {
+        final int dataSpaceId = h5.getDataSpaceForDataSet(dataSetId, registry);
+        return getBufferSpaceParameters(dataSpaceId, h5.getDataSpaceDimensions(dataSpaceId),
+                offset, blockSize, bufferLength, memoryOffset, registry);
+    }
+
+    /**
+     * Returns the {@link DataSpaceParameters} for reading a 1d block of the given
+     * <var>dataset</var> into a buffer of <var>bufferLength</var> elements, starting at
+     * <var>memoryOffset</var> of the buffer.
+     */
+    DataSpaceParameters getBufferSpaceParameters(final HDF5DataSet dataset, final long offset,
+            final int blockSize, final int bufferLength, final int memoryOffset,
+            ICleanUpRegistry registry)
+    {
+        return getBufferSpaceParameters(dataset.getDataspaceId(), dataset.getDimensions(), offset,
+                blockSize, bufferLength, memoryOffset, registry);
+    }
+
+    private DataSpaceParameters getBufferSpaceParameters(final int dataSpaceId,
+            final long[] dimensions, final long offset, final int blockSize,
+            final int bufferLength, final int memoryOffset, ICleanUpRegistry registry)
+    {
+        if (dimensions.length != 1)
+        {
+            throw new HDF5JavaException("Data Set is expected to be of rank 1 (rank="
+                    + dimensions.length + ")");
+        }
+        if (blockSize <= 0 || memoryOffset < 0 || blockSize + memoryOffset > bufferLength)
+        {
+            throw new HDF5JavaException("Buffer not large enough for blockSize and memoryOffset");
+        }
+        final long size = dimensions[0];
+        final long maxFileBlockSize = size - offset;
+        if (maxFileBlockSize <= 0)
+        {
+            throw new HDF5JavaException("Offset " + offset + " >= Size " + size);
+        }
+        final int effectiveBlockSize = (int) Math.min(blockSize, maxFileBlockSize);
+        final long[] blockShape = new long[]
+            { effectiveBlockSize };
+        h5.setHyperslabBlock(dataSpaceId, new long[]
+            { offset }, blockShape);
+        final int memorySpaceId = h5.createSimpleDataSpace(new long[]
+            { bufferLength }, registry);
+        h5.setHyperslabBlock(memorySpaceId, new long[]
+            { memoryOffset }, blockShape);
+        return new DataSpaceParameters(memorySpaceId, dataSpaceId, effectiveBlockSize, dimensions);
+    }
+
     /**
      * Returns the {@link DataSpaceParameters} for a 1d block of the given <var>dataSetId</var>.
      */
@@ -1187,6 +1278,78 @@ class HDF5BaseReader
         return typeVariantOrdinal < 0 ? null : HDF5DataTypeVariant.values()[typeVariantOrdinal];
     }
 
+    /**
+     * Returns <code>true</code>, if <var>dataSetId</var> is a dictionary-encoded string data set.
+     */
+    boolean isStringDictionaryEncoded(final int dataSetId, ICleanUpRegistry registry)
+    {
+        final int dataTypeId = h5.getNativeDataTypeForDataSet(dataSetId, registry);
+        return h5.getClassType(dataTypeId) == H5T_INTEGER
+                && HDF5DataTypeVariant.STRING_DICTIONARY == tryGetTypeVariant(dataSetId, registry);
+    }
+
+    /**
+     * Returns the current path of the dictionary of the dictionary-encoded string data set
+     * <var>dataSetId</var> at <var>objectPath</var>. The dictionary is found by the object
+     * reference stored on the data set, so that it is found after moving either of the two.
+     */
+    String getStringDictionaryPath(final int dataSetId, final String objectPath,
+            ICleanUpRegistry registry)
+    {
+        final String attributeName = getStringDictionaryAttributeName(houseKeepingNameSuffix);
+        if (h5.existsAttribute(dataSetId, attributeName) == false)
+        {
+            // Written without the reference, the dictionary can only be next to the data set.
+            return HDF5Utils.getStringDictionaryPath(objectPath, houseKeepingNameSuffix);
+        }
+        final int attributeId = h5.openAttribute(dataSetId, attributeName, registry);
+        final int dataTypeId = h5.getDataTypeForAttribute(attributeId, registry);
+        final long[] reference = h5.readAttributeAsLongArray(attributeId, dataTypeId, 1);
+        return h5.getReferencedObjectName(attributeId, reference[0]);
+    }
+
+    /**
+     * Returns the current path of the dictionary of the data set <var>objectPath</var>, if it is a
+     * dictionary-encoded string data set, or <code>null</code> otherwise.
+     */
+    String tryGetStringDictionaryPath(final String objectPath)
+    {
+        final ICallableWithCleanUp<String> readRunnable = new ICallableWithCleanUp<String>()
+            {
+                @Override
+                public String call(ICleanUpRegistry registry)
+                {
+                    final int dataSetId = h5.openDataSet(fileId, objectPath, registry);
+                    if (isStringDictionaryEncoded(dataSetId, registry) == false)
+                    {
+                        return null;
+                    }
+                    return getStringDictionaryPath(dataSetId, objectPath, registry);
+                }
+            };
+        return runner.call(readRunnable);
+    }
+
+    /**
+     * Returns <code>true</code>, if the dictionary-encoded string data set <var>objectPath</var>
+     * refers to its dictionary by an object reference, so that the dictionary is found wherever it
+     * is.
+     */
+    boolean hasStringDictionaryReference(final String objectPath)
+    {
+        final ICallableWithCleanUp<Boolean> readRunnable = new ICallableWithCleanUp<Boolean>()
+            {
+                @Override
+                public Boolean call(ICleanUpRegistry registry)
+                {
+                    final int dataSetId = h5.openDataSet(fileId, objectPath, registry);
+                    return h5.existsAttribute(dataSetId,
+                            getStringDictionaryAttributeName(houseKeepingNameSuffix));
+                }
+            };
+        return runner.call(readRunnable);
+    }
+
     /**
      * Returns the ordinal for the type variant of <var>objectPath</var>, or <code>-1</code>, if no
      * type variant is defined for this <var>objectPath</var>.
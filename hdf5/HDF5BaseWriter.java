@@ -37,15 +37,11 @@ import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_STD_I8LE;
 import java.io.File;
 import java.io.FileNotFoundException;
 import java.io.Flushable;
-import java.io.IOException;
 import java.io.RandomAccessFile;
 import java.util.EnumSet;
 import java.util.LinkedHashSet;
 import java.util.Set;
-import java.util.concurrent.BlockingQueue;
-import java.util.concurrent.ExecutorService;
-import java.util.concurrent.LinkedBlockingQueue;
-import java.util.concurrent.TimeUnit;
+import java.util.concurrent.Future;
 
 import ncsa.hdf.hdf5lib.exceptions.HDF5DatasetInterfaceException;
 import ncsa.hdf.hdf5lib.exceptions.HDF5FileNotFoundException;
@@ -54,7 +50,6 @@ import ncsa.hdf.hdf5lib.exceptions.HDF5JavaException;
 import ch.systemsx.cisd.base.exceptions.CheckedExceptionTunnel;
 import ch.systemsx.cisd.base.exceptions.IErrorStrategy;
 import ch.systemsx.cisd.base.mdarray.MDArray;
-import ch.systemsx.cisd.base.namedthread.NamingThreadPoolExecutor;
 import ch.systemsx.cisd.hdf5.IHDF5CompoundInformationRetriever.IByteArrayInspector;
 import ch.systemsx.cisd.hdf5.IHDF5WriterConfigurator.FileFormat;
 import ch.systemsx.cisd.hdf5.IHDF5WriterConfigurator.SyncMode;
@@ -88,40 +83,30 @@ final class HDF5BaseWriter extends HDF5BaseReader
     final static int COMPACT_LAYOUT_THRESHOLD = 256;
 
     /**
-     * ExecutorService for calling <code>fsync(2)</code> in a non-blocking way.
+     * The number of files that are synced at the same time.
      */
-    private final static ExecutorService syncExecutor = new NamingThreadPoolExecutor("HDF5 Sync")
-            .corePoolSize(3).daemonize();
+    private static final int NUMBER_OF_SYNC_THREADS = 3;
+
+    /**
+     * Scheduler for calling <code>fsync(2)</code> in a non-blocking way, shared by all writers.
+     */
+    private final static HDF5SyncScheduler syncScheduler = new HDF5SyncScheduler(
+            NUMBER_OF_SYNC_THREADS);
 
     static
     {
-        // Ensure all sync() calls are finished.
+        // Ensure all files are closed and all sync() calls are finished.
         Runtime.getRuntime().addShutdownHook(new Thread()
             {
                 @Override
                 public void run()
                 {
-                    syncExecutor.shutdownNow();
-                    try
-                    {
-                        syncExecutor.awaitTermination(SHUTDOWN_TIMEOUT_SECONDS, TimeUnit.SECONDS);
-                    } catch (InterruptedException ex)
-                    {
-                        // Unexpected
-                        ex.printStackTrace();
-                    }
+                    syncScheduler.shutdown(SHUTDOWN_TIMEOUT_SECONDS);
                 }
             });
     }
 
-    private final RandomAccessFile fileForSyncing;
-
-    private enum Command
-    {
-        SYNC, CLOSE_ON_EXIT, CLOSE_SYNC, EXIT
-    }
-
-    private final BlockingQueue<Command> commandQueue;
+    private final HDF5SyncScheduler.Target syncTarget;
 
     private final Set<Flushable> flushables = new LinkedHashSet<Flushable>();
 
@@ -137,69 +122,84 @@ final class HDF5BaseWriter extends HDF5BaseReader
 
     final FileFormat fileFormat;
 
+    private final HDF5ParallelChunkWriter parallelChunkWriterOrNull;
+
+    private final HDF5WriteBehindBuffers writeBehindBuffersOrNull;
+
     HDF5BaseWriter(File hdf5File, boolean performNumericConversions, boolean useUTF8CharEncoding,
             boolean autoDereference, FileFormat fileFormat, boolean useExtentableDataTypes,
             boolean overwriteFile, boolean keepDataSetIfExists,
             boolean useSimpleDataSpaceForAttributes, String preferredHouseKeepingNameSuffix,
-            SyncMode syncMode)
+            SyncMode syncMode, HDF5ChunkCacheParameters chunkCacheOrNull,
+            HDF5FileAccessParameters fileAccessParametersOrNull,
+            boolean convertCompoundsInJava, int numberOfCompressionThreads,
+            int writeBehindBufferSize)
     {
         super(hdf5File, performNumericConversions, useUTF8CharEncoding, autoDereference,
-                fileFormat, overwriteFile, preferredHouseKeepingNameSuffix);
-        try
+                fileFormat, overwriteFile, preferredHouseKeepingNameSuffix, chunkCacheOrNull,
+                fileAccessParametersOrNull, convertCompoundsInJava);
+        RandomAccessFile fileForSyncingOrNull = null;
+        // An in-memory file is only written to disk (if at all) when it is closed.
+        if (fileAccessParametersOrNull == null || fileAccessParametersOrNull.isInMemory() == false)
         {
-            this.fileForSyncing = new RandomAccessFile(hdf5File, "rw");
-        } catch (FileNotFoundException ex)
-        {
-            // Should not be happening as openFile() was called in super()
-            throw new HDF5JavaException("Cannot open RandomAccessFile: " + ex.getMessage());
+            try
+            {
+                fileForSyncingOrNull = new RandomAccessFile(hdf5File, "rw");
+            } catch (FileNotFoundException ex)
+            {
+                // Should not be happening as openFile() was called in super()
+                throw new HDF5JavaException("Cannot open RandomAccessFile: " + ex.getMessage());
+            }
         }
+        this.syncTarget = syncScheduler.register(fileForSyncingOrNull, new Runnable()
+            {
+                @Override
+                public void run()
+                {
+                    closeNow();
+                }
+            });
         this.fileFormat = fileFormat;
         this.useExtentableDataTypes = useExtentableDataTypes;
         this.overwriteFile = overwriteFile;
         this.keepDataSetIfExists = keepDataSetIfExists;
         this.useSimpleDataSpaceForAttributes = useSimpleDataSpaceForAttributes;
         this.syncMode = syncMode;
-        readNamedDataTypes();
-        saveNonDefaultHouseKeepingNameSuffix();
-        commandQueue = new LinkedBlockingQueue<Command>();
-        setupSyncThread();
-    }
-
-    private void setupSyncThread()
-    {
-        syncExecutor.execute(new Runnable()
-            {
-                @Override
-                public void run()
+        this.parallelChunkWriterOrNull =
+                (numberOfCompressionThreads > 0) ? new HDF5ParallelChunkWriter(
+                        numberOfCompressionThreads) : null;
+        if (parallelChunkWriterOrNull != null)
+        {
+            final HDF5ParallelChunkWriter chunkWriter = parallelChunkWriterOrNull;
+            // Chunk encodings are keyed by data set path.
+            h5.addLinkChangeListener(new Runnable()
                 {
-                    while (true)
+                    @Override
+                    public void run()
                     {
-                        try
-                        {
-                            switch (commandQueue.take())
-                            {
-                                case SYNC:
-                                    syncNow();
-                                    break;
-                                case CLOSE_ON_EXIT:
-                                    closeNow();
-                                    return;
-                                case CLOSE_SYNC:
-                                    closeSync();
-                                    return;
-                                case EXIT:
-                                    return;
-                            }
-                        } catch (InterruptedException ex)
-                        {
-                            // Shutdown has been triggered by showdownNow(), add
-                            // <code>CLOSEHDF</code> to queue.
-                            // (Note that a close() on a closed RandomAccessFile is harmless.)
-                            commandQueue.add(Command.CLOSE_ON_EXIT);
-                        }
+                        chunkWriter.clearEncodings();
                     }
-                }
-            });
+                });
+        }
+        this.writeBehindBuffersOrNull =
+                (writeBehindBufferSize != 0) ? new HDF5WriteBehindBuffers(this,
+                        writeBehindBufferSize) : null;
+        if (writeBehindBuffersOrNull != null)
+        {
+            final HDF5WriteBehindBuffers buffers = writeBehindBuffersOrNull;
+            // Any other access to a data set needs to see the data buffered for it.
+            h5.addObjectAccessListener(new HDF5.IObjectAccessListener()
+                {
+                    @Override
+                    public void objectAccessed(String path)
+                    {
+                        buffers.flush(path);
+                    }
+                });
+            addFlushable(writeBehindBuffersOrNull);
+        }
+        readNamedDataTypes();
+        saveNonDefaultHouseKeepingNameSuffix();
     }
 
     @Override
@@ -215,6 +215,13 @@ final class HDF5BaseWriter extends HDF5BaseReader
             return h5.openFileReadWrite(hdf5File.getPath(), enforce_1_8, fileRegistry);
         } else
         {
+            final HDF5FileAccessParameters fileAccessParametersOrNull =
+                    h5.tryGetFileAccessParameters();
+            if (fileAccessParametersOrNull != null && fileAccessParametersOrNull.isDiskless())
+            {
+                // Nothing is written to the directory.
+                return h5.createFile(hdf5File.getPath(), enforce_1_8, fileRegistry);
+            }
             final File directory = hdf5File.getParentFile();
             if (directory.exists() == false)
             {
@@ -229,30 +236,18 @@ final class HDF5BaseWriter extends HDF5BaseReader
     }
 
     /**
-     * Calls <code>fsync(2)</code> in the current thread.
+     * Calls <code>fsync(2)</code> and waits for it to return. If no sync of the file is pending,
+     * the sync is called in the current thread.
      */
     private void syncNow()
     {
-        try
-        {
-            // Implementation note 1: Unix will call fsync(), , Windows: FlushFileBuffers()
-            // Implementation note 2: We do not call fileForSyncing.getChannel().force(false) which
-            // might be better in terms of performance as if shutdownNow() already has been
-            // triggered on the syncExecutor and thus this thread has already been interrupted,
-            // channel methods would throw a ClosedByInterruptException at us no matter what we do.
-            fileForSyncing.getFD().sync();
-        } catch (IOException ex)
-        {
-            final String msg =
-                    (ex.getMessage() == null) ? ex.getClass().getSimpleName() : ex.getMessage();
-            throw new HDF5JavaException("Error syncing file: " + msg);
-        }
+        syncScheduler.sync(syncTarget);
     }
 
     /**
      * Closes and, depending on the sync mode, syncs the HDF5 file in the current thread.
      * <p>
-     * To be called from the syncer thread only.
+     * To be called on exit of the JVM only.
      */
     private void closeNow()
     {
@@ -263,6 +258,10 @@ final class HDF5BaseWriter extends HDF5BaseReader
                 flushExternals();
                 flushables.clear();
                 super.close();
+                if (parallelChunkWriterOrNull != null)
+                {
+                    parallelChunkWriterOrNull.shutdown();
+                }
                 if (SYNC_ON_CLOSE_MODES.contains(syncMode))
                 {
                     syncNow();
@@ -274,13 +273,26 @@ final class HDF5BaseWriter extends HDF5BaseReader
 
     private void closeSync()
     {
-        try
-        {
-            fileForSyncing.close();
-        } catch (IOException ex)
+        syncScheduler.close(syncTarget);
+    }
+
+    /**
+     * Buffers the block <var>data</var> of <var>dataSize</var> elements that goes to
+     * <var>offset</var> of the one-dimensional data set <var>objectPath</var>, if write-behind
+     * buffering is enabled and the block is small enough.
+     *
+     * @return <code>true</code>, if the block has been taken care of, <code>false</code>, if the
+     *         caller needs to write it.
+     */
+    boolean tryWriteBehind(String objectPath, int memoryTypeId, Object data, int dataSize,
+            long offset)
+    {
+        if (writeBehindBuffersOrNull == null)
         {
-            throw new HDF5JavaException("Error closing file: " + ex.getMessage());
+            return false;
         }
+        checkOpen();
+        return writeBehindBuffersOrNull.tryWrite(objectPath, memoryTypeId, data, dataSize, offset);
     }
 
     boolean addFlushable(Flushable flushable)
@@ -321,7 +333,7 @@ final class HDF5BaseWriter extends HDF5BaseReader
             h5.flushFile(fileId);
             if (NON_BLOCKING_SYNC_MODES.contains(syncMode))
             {
-                commandQueue.add(Command.SYNC);
+                syncScheduler.requestSync(syncTarget);
             } else if (BLOCKING_SYNC_MODES.contains(syncMode))
             {
                 syncNow();
@@ -329,6 +341,26 @@ final class HDF5BaseWriter extends HDF5BaseReader
         }
     }
 
+    Future<Void> flushAsync()
+    {
+        synchronized (fileRegistry)
+        {
+            flushExternals();
+            h5.flushFile(fileId);
+            return syncScheduler.requestSync(syncTarget);
+        }
+    }
+
+    HDF5SyncStatistics getSyncStatistics()
+    {
+        return syncTarget.getStatistics();
+    }
+
+    static HDF5SyncStatistics getGlobalSyncStatistics()
+    {
+        return syncScheduler.getStatistics();
+    }
+
     void flushSyncBlocking()
     {
         synchronized (fileRegistry)
@@ -349,25 +381,19 @@ final class HDF5BaseWriter extends HDF5BaseReader
                 flushExternals();
                 flushables.clear();
                 super.close();
+                if (parallelChunkWriterOrNull != null)
+                {
+                    parallelChunkWriterOrNull.shutdown();
+                }
                 if (SyncMode.SYNC == syncMode)
                 {
-                    commandQueue.add(Command.SYNC);
+                    syncScheduler.requestSync(syncTarget);
                 } else if (SyncMode.SYNC_BLOCK == syncMode)
                 {
                     syncNow();
                 }
-
-                if (EnumSet.complementOf(NON_BLOCKING_SYNC_MODES).contains(syncMode))
-                {
-                    closeSync();
-                    commandQueue.add(Command.EXIT);
-                } else
-                {
-                    // End syncer thread and avoid a race condition for non-blocking sync modes as
-                    // the
-                    // syncer thread still may want to use the fileForSynching
-                    commandQueue.add(Command.CLOSE_SYNC);
-                }
+                // Closes the file for syncing once the pending syncs are done.
+                closeSync();
             }
         }
     }
@@ -524,8 +550,10 @@ final class HDF5BaseWriter extends HDF5BaseReader
                 @Override
                 public Void call(ICleanUpRegistry registry)
                 {
+                    final HDF5VLStringArena arenaOrNull =
+                            type.getObjectByteifyer().tryCreateVLStringArena();
                     final byte[] byteArray =
-                            type.getObjectByteifyer().byteify(type.getStorageTypeId(), data);
+                            type.getObjectByteifyer().byteify(type.getStorageTypeId(), data, arenaOrNull);
                     if (inspectorOrNull != null)
                     {
                         inspectorOrNull.inspect(byteArray);
@@ -538,7 +566,7 @@ final class HDF5BaseWriter extends HDF5BaseReader
                             h5.createArrayType(baseStorageTypeId, data.length, registry);
                     setAttribute(objectPath, attributeName, storageTypeId, memoryTypeId, -1,
                             byteArray, registry);
-                    h5.reclaimCompoundVL(type, byteArray);
+                    h5.reclaimCompoundVL(type, byteArray, arenaOrNull);
 
                     return null; // Nothing to return.
                 }
@@ -561,9 +589,11 @@ final class HDF5BaseWriter extends HDF5BaseReader
                 @Override
                 public Void call(ICleanUpRegistry registry)
                 {
+                    final HDF5VLStringArena arenaOrNull =
+                            type.getObjectByteifyer().tryCreateVLStringArena();
                     final byte[] byteArray =
                             type.getObjectByteifyer().byteify(type.getStorageTypeId(),
-                                    data.getAsFlatArray());
+                                    data.getAsFlatArray(), arenaOrNull);
                     if (inspectorOrNull != null)
                     {
                         inspectorOrNull.inspect(byteArray);
@@ -576,7 +606,7 @@ final class HDF5BaseWriter extends HDF5BaseReader
                             h5.createArrayType(baseStorageTypeId, data.dimensions(), registry);
                     setAttribute(objectPath, attributeName, storageTypeId, memoryTypeId, -1,
                             byteArray, registry);
-                    h5.reclaimCompoundVL(type, byteArray);
+                    h5.reclaimCompoundVL(type, byteArray, arenaOrNull);
 
                     return null; // Nothing to return.
                 }
@@ -630,7 +660,7 @@ final class HDF5BaseWriter extends HDF5BaseReader
         boolean exists = h5.exists(fileId, dataSetPath);
         if (exists && keepDatasetIfExists == false)
         {
-            h5.deleteObject(fileId, dataSetPath);
+            deleteObjectAndDictionary(dataSetPath);
             exists = false;
         }
         if (exists)
@@ -680,7 +710,7 @@ final class HDF5BaseWriter extends HDF5BaseReader
         boolean exists = h5.exists(fileId, dataSetPath);
         if (exists && keepDatasetIfExists == false)
         {
-            h5.deleteObject(fileId, dataSetPath);
+            deleteObjectAndDictionary(dataSetPath);
             exists = false;
         }
         if (exists)
@@ -731,7 +761,7 @@ final class HDF5BaseWriter extends HDF5BaseReader
         boolean exists = h5.exists(fileId, dataSetPath);
         if (exists && keepDatasetIfExists == false)
         {
-            h5.deleteObject(fileId, dataSetPath);
+            deleteObjectAndDictionary(dataSetPath);
             exists = false;
         }
         if (exists)
@@ -782,7 +812,7 @@ final class HDF5BaseWriter extends HDF5BaseReader
         boolean exists = h5.exists(fileId, dataSetPath);
         if (exists && keepDatasetIfExists == false)
         {
-            h5.deleteObject(fileId, dataSetPath);
+            deleteObjectAndDictionary(dataSetPath);
             exists = false;
         }
         if (exists)
@@ -833,7 +863,7 @@ final class HDF5BaseWriter extends HDF5BaseReader
         boolean exists = h5.exists(fileId, dataSetPath);
         if (exists && keepDatasetIfExists == false)
         {
-            h5.deleteObject(fileId, dataSetPath);
+            deleteObjectAndDictionary(dataSetPath);
             exists = false;
         }
         if (exists)
@@ -884,7 +914,7 @@ final class HDF5BaseWriter extends HDF5BaseReader
         boolean exists = h5.exists(fileId, dataSetPath);
         if (exists && keepDatasetIfExists == false)
         {
-            h5.deleteObject(fileId, dataSetPath);
+            deleteObjectAndDictionary(dataSetPath);
             exists = false;
         }
         if (exists)
@@ -935,7 +965,7 @@ final class HDF5BaseWriter extends HDF5BaseReader
         boolean exists = h5.exists(fileId, dataSetPath);
         if (exists && keepDatasetIfExists == false)
         {
-            h5.deleteObject(fileId, dataSetPath);
+            deleteObjectAndDictionary(dataSetPath);
             exists = false;
         }
         if (exists)
@@ -995,13 +1025,14 @@ final class HDF5BaseWriter extends HDF5BaseReader
             {
                 return h5.openDataSet(fileId, objectPath, registry);
             }
-            h5.deleteObject(fileId, objectPath);
+            deleteObjectAndDictionary(objectPath);
         }
         if (empty)
         {
             definitiveChunkSizeOrNull =
                     chunkSizeProvided ? chunkSizeOrNull : HDF5Utils.tryGetChunkSize(dimensions,
-                            elementLength, features.requiresChunking(), true);
+                            elementLength, features.requiresChunking(), true,
+                            features.getChunkAccessPattern(), features.getChunkTargetSize());
         } else if (features.tryGetProposedLayout() == HDF5StorageLayout.COMPACT
                 || features.tryGetProposedLayout() == HDF5StorageLayout.CONTIGUOUS
                 || (useExtentableDataTypes == false) && features.requiresChunking() == false)
@@ -1013,13 +1044,10 @@ final class HDF5BaseWriter extends HDF5BaseReader
         } else
         {
             definitiveChunkSizeOrNull =
-                    HDF5Utils
-                            .tryGetChunkSize(
-                                    dimensions,
-                                    elementLength,
-                                    features.requiresChunking(),
-                                    useExtentableDataTypes
-                                            || features.tryGetProposedLayout() == HDF5StorageLayout.CHUNKED);
+                    HDF5Utils.tryGetChunkSize(dimensions, elementLength,
+                            features.requiresChunking(), useExtentableDataTypes
+                                    || features.tryGetProposedLayout() == HDF5StorageLayout.CHUNKED,
+                            features.getChunkAccessPattern(), features.getChunkTargetSize());
         }
         final HDF5StorageLayout layout =
                 determineLayout(storageDataTypeId, dimensions, definitiveChunkSizeOrNull,
@@ -1045,7 +1073,8 @@ final class HDF5BaseWriter extends HDF5BaseReader
         {
             definitiveChunkSizeOrNull =
                     chunkSizeProvided ? chunkSizeOrNull : HDF5Utils.tryGetChunkSize(dimensions,
-                            elementLength, features.requiresChunking(), true);
+                            elementLength, features.requiresChunking(), true,
+                            features.getChunkAccessPattern(), features.getChunkTargetSize());
         } else if (features.tryGetProposedLayout() == HDF5StorageLayout.COMPACT
                 || features.tryGetProposedLayout() == HDF5StorageLayout.CONTIGUOUS
                 || (useExtentableDataTypes == false) && features.requiresChunking() == false)
@@ -1057,13 +1086,10 @@ final class HDF5BaseWriter extends HDF5BaseReader
         } else
         {
             definitiveChunkSizeOrNull =
-                    HDF5Utils
-                            .tryGetChunkSize(
-                                    dimensions,
-                                    elementLength,
-                                    features.requiresChunking(),
-                                    useExtentableDataTypes
-                                            || features.tryGetProposedLayout() == HDF5StorageLayout.CHUNKED);
+                    HDF5Utils.tryGetChunkSize(dimensions, elementLength,
+                            features.requiresChunking(), useExtentableDataTypes
+                                    || features.tryGetProposedLayout() == HDF5StorageLayout.CHUNKED,
+                            features.getChunkAccessPattern(), features.getChunkTargetSize());
         }
         final HDF5StorageLayout layout =
                 determineLayout(storageDataTypeId, dimensions, definitiveChunkSizeOrNull,
@@ -1083,6 +1109,34 @@ final class HDF5BaseWriter extends HDF5BaseReader
                 dataSetTemplate.getDataspaceId(), objectPath, registry);
     }
 
+    /**
+     * Deletes the object <var>objectPath</var>. If it is a dictionary-encoded string data set (and
+     * not a link to one), its dictionary is deleted as well.
+     */
+    void deleteObjectAndDictionary(final String objectPath)
+    {
+        final String dictionaryPathOrNull = tryGetOwnStringDictionaryPath(objectPath);
+        h5.deleteObject(fileId, objectPath);
+        // The dictionary may have gone already with the group it is in.
+        if (dictionaryPathOrNull != null && h5.exists(fileId, dictionaryPathOrNull))
+        {
+            h5.deleteObject(fileId, dictionaryPathOrNull);
+        }
+    }
+
+    /**
+     * Returns the path of the dictionary of <var>objectPath</var>, if it exists and is a
+     * dictionary-encoded string data set (and not a link to one), or <code>null</code> otherwise.
+     */
+    String tryGetOwnStringDictionaryPath(final String objectPath)
+    {
+        if (HDF5ObjectType.isDataSet(h5.getLinkTypeInfo(fileId, objectPath, false)) == false)
+        {
+            return null;
+        }
+        return tryGetStringDictionaryPath(objectPath);
+    }
+
     boolean keepDataIfExists(final HDF5AbstractStorageFeatures features)
     {
         switch (features.getDatasetReplacementPolicy())
@@ -1164,7 +1218,7 @@ final class HDF5BaseWriter extends HDF5BaseReader
         boolean exists = h5.exists(fileId, objectPath);
         if (exists && keepDataIfExists(features) == false)
         {
-            h5.deleteObject(fileId, objectPath);
+            deleteObjectAndDictionary(objectPath);
             exists = false;
         }
         if (exists)
@@ -1181,6 +1235,23 @@ final class HDF5BaseWriter extends HDF5BaseReader
         return dataSetId;
     }
 
+    /**
+     * Writes the block <var>flatData</var> of the data set <var>dataSetId</var> at
+     * <var>objectPath</var> with parallel compression, if this has been configured and is possible
+     * for this data set and block.
+     *
+     * @return <code>true</code>, if the block has been written, <code>false</code>, if the caller
+     *         needs to write it by means of <code>H5Dwrite</code>.
+     */
+    boolean tryWriteCompressedInParallel(String objectPath, int dataSetId, int memoryTypeId,
+            long[] blockOffsetOrNull, long[] blockDimensions, Object flatData,
+            ICleanUpRegistry registry)
+    {
+        return parallelChunkWriterOrNull != null
+                && parallelChunkWriterOrNull.tryWrite(h5, objectPath, dataSetId, memoryTypeId,
+                        blockOffsetOrNull, blockDimensions, flatData, registry);
+    }
+
     void setDataSetDimensions(final String objectPath, final long[] newDimensions,
             ICleanUpRegistry registry)
     {
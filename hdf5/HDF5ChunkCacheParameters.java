@@ -0,0 +1,106 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5;
+
+/**
+ * The parameters of the HDF5 raw data chunk cache.
+ * <p>
+ * The chunk cache holds decompressed chunks of chunked data sets. The library default of 1 MB and
+ * 521 slots is too small if a data set is accessed in an order that touches many chunks before
+ * coming back to one, e.g. when reading a chunked and compressed matrix column by column. As a
+ * rule of thumb, the cache should be big enough to hold all chunks touched by one such pass and
+ * the number of slots should be a prime number about 100 times the number of chunks that fit
+ * into the cache.
+ *
+ * @author Bernd Rinn
+ */
+public final class HDF5ChunkCacheParameters
+{
+    private final int numberOfSlots;
+
+    private final int sizeInBytes;
+
+    private final double preemptionPolicy;
+
+    /**
+     * Creates the parameters of a chunk cache.
+     *
+     * @param numberOfSlots The number of slots in the hash table of the chunk cache.
+     * @param sizeInBytes The total size of the chunk cache, in bytes.
+     * @param preemptionPolicy The preemption policy, a value between 0 and 1. 0 means to evict the
+     *            least recently used chunk first, 1 means to evict fully read or written chunks
+     *            first.
+     */
+    public HDF5ChunkCacheParameters(int numberOfSlots, int sizeInBytes, double preemptionPolicy)
+    {
+        if (numberOfSlots < 0 || sizeInBytes < 0)
+        {
+            throw new IllegalArgumentException("Number of slots and size must not be negative.");
+        }
+        if (preemptionPolicy < 0.0 || preemptionPolicy > 1.0)
+        {
+            throw new IllegalArgumentException("Preemption policy needs to be in [0, 1], found: "
+                    + preemptionPolicy);
+        }
+        this.numberOfSlots = numberOfSlots;
+        this.sizeInBytes = sizeInBytes;
+        this.preemptionPolicy = preemptionPolicy;
+    }
+
+    /**
+     * Creates the parameters of a chunk cache with the default preemption policy of 0.75.
+     *
+     * @param numberOfSlots The number of slots in the hash table of the chunk cache.
+     * @param sizeInBytes The total size of the chunk cache, in bytes.
+     */
+    public HDF5ChunkCacheParameters(int numberOfSlots, int sizeInBytes)
+    {
+        this(numberOfSlots, sizeInBytes, 0.75);
+    }
+
+    /**
+     * Returns the number of slots in the hash table of the chunk cache.
+     */
+    public int getNumberOfSlots()
+    {
+        return numberOfSlots;
+    }
+
+    /**
+     * Returns the total size of the chunk cache, in bytes.
+     */
+    public int getSizeInBytes()
+    {
+        return sizeInBytes;
+    }
+
+    /**
+     * Returns the preemption policy of the chunk cache.
+     */
+    public double getPreemptionPolicy()
+    {
+        return preemptionPolicy;
+    }
+
+    @Override
+    public String toString()
+    {
+        return "HDF5ChunkCacheParameters [numberOfSlots=" + numberOfSlots + ", sizeInBytes="
+                + sizeInBytes + ", preemptionPolicy=" + preemptionPolicy + "]";
+    }
+
+}
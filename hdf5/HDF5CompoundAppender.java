@@ -0,0 +1,310 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5;
+
+import static ch.systemsx.cisd.hdf5.hdf5lib.H5D.H5Dwrite;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5P_DEFAULT;
+
+import java.io.Flushable;
+import java.util.Arrays;
+
+import ncsa.hdf.hdf5lib.exceptions.HDF5JavaException;
+
+import ch.systemsx.cisd.hdf5.cleanup.ICallableWithCleanUp;
+import ch.systemsx.cisd.hdf5.cleanup.ICleanUpRegistry;
+
+/**
+ * An appender for records to the end of a one-dimensional, chunked compound data set.
+ * <p>
+ * Records are byteified into a re-used buffer and written as one block when the buffer is full, on
+ * {@link #flush()}, on {@link #close()} and when the writer is flushed or closed. They are also
+ * written when a record is appended and the oldest buffered record is older than the maximal
+ * delay. The delay is only checked on append, there is no background thread: an appender that
+ * gets no more records keeps its buffered records until it or the writer is flushed or closed.
+ * Each write extends the data set by the number of records written.
+ * <p>
+ * The pattern for using this class is:
+ *
+ * <pre>
+ * final HDF5CompoundAppender&lt;Event&gt; appender =
+ *         writer.compound().getAppender(&quot;/events&quot;, eventType);
+ * try
+ * {
+ *     for (Event e : events)
+ *     {
+ *         appender.append(e);
+ *     }
+ * } finally
+ * {
+ *     appender.close();
+ * }
+ * </pre>
+ * <p>
+ * <i>This class is not thread-safe.</i>
+ *
+ * @author Bernd Rinn
+ */
+public final class HDF5CompoundAppender<T> implements Flushable, AutoCloseable
+{
+
+    /** The default number of records written in one block. */
+    public static final int DEFAULT_BATCH_SIZE = 4096;
+
+    /**
+     * The default time in milliseconds after which the buffered records are written on the next
+     * append.
+     */
+    public static final long DEFAULT_MAX_DELAY_MILLIS = 1000L;
+
+    private final HDF5BaseWriter baseWriter;
+
+    private final String objectPath;
+
+    private final HDF5CompoundType<T> type;
+
+    private final int recordSize;
+
+    private final int batchSize;
+
+    private final long maxDelayMillis;
+
+    private final HDF5VLStringArena arenaOrNull;
+
+    private final byte[] buffer;
+
+    /**
+     * The buffered records, if the type has variable-length string members. They are kept in
+     * order to byteify them again if writing them fails, as their strings are released after each
+     * write.
+     */
+    private final Object[] recordsOrNull;
+
+    /** <code>true</code>, if the buffered records need to be byteified again. */
+    private boolean stale;
+
+    private long offset;
+
+    private int count;
+
+    private long firstBufferedMillis;
+
+    private boolean closed;
+
+    HDF5CompoundAppender(HDF5BaseWriter baseWriter, String objectPath, HDF5CompoundType<T> type,
+            long offset, int batchSize, long maxDelayMillis)
+    {
+        if (batchSize < 1)
+        {
+            throw new IllegalArgumentException("Batch size needs to be >= 1, found: " + batchSize);
+        }
+        this.baseWriter = baseWriter;
+        this.objectPath = objectPath;
+        this.type = type;
+        this.recordSize = type.getObjectByteifyer().getRecordSizeInMemory();
+        if ((long) batchSize * recordSize > Integer.MAX_VALUE)
+        {
+            throw new IllegalArgumentException("Batch size " + batchSize
+                    + " is too large for records of " + recordSize + " bytes.");
+        }
+        this.batchSize = batchSize;
+        this.maxDelayMillis = maxDelayMillis;
+        this.arenaOrNull = type.getObjectByteifyer().tryCreateVLStringArena();
+        this.buffer = new byte[batchSize * recordSize];
+        this.recordsOrNull = (arenaOrNull != null) ? new Object[batchSize] : null;
+        this.offset = offset;
+        baseWriter.addFlushable(this);
+    }
+
+    /**
+     * Returns the path of the data set that this appender appends to.
+     */
+    public String getObjectPath()
+    {
+        return objectPath;
+    }
+
+    /**
+     * Returns the number of records in the data set, including the records that are not yet
+     * written.
+     */
+    public long getSize()
+    {
+        return offset + count;
+    }
+
+    /**
+     * Returns the number of records that are buffered and not yet written.
+     */
+    public int getNumberOfBufferedRecords()
+    {
+        return count;
+    }
+
+    /**
+     * Appends <var>record</var> to the data set.
+     *
+     * @throws HDF5JavaException If one of the members of <var>record</var> exceeds its pre-defined
+     *             size or if this appender is closed.
+     */
+    public void append(T record) throws HDF5JavaException
+    {
+        checkOpen();
+        if (count == batchSize)
+        {
+            // The last write has failed, retry it before buffering more records.
+            flush();
+        }
+        type.getObjectByteifyer().byteify(type.getStorageTypeId(), record, buffer,
+                count * recordSize, arenaOrNull);
+        if (recordsOrNull != null)
+        {
+            recordsOrNull[count] = record;
+        }
+        if (count++ == 0)
+        {
+            firstBufferedMillis = System.currentTimeMillis();
+        }
+        if (count == batchSize
+                || System.currentTimeMillis() - firstBufferedMillis >= maxDelayMillis)
+        {
+            flush();
+        }
+    }
+
+    /**
+     * Appends all <var>records</var> to the data set.
+     *
+     * @throws HDF5JavaException If one of the members of a record exceeds its pre-defined size or
+     *             if this appender is closed.
+     */
+    public void append(T[] records) throws HDF5JavaException
+    {
+        for (T record : records)
+        {
+            append(record);
+        }
+    }
+
+    /**
+     * Writes all buffered records to the data set. If writing fails, the buffered records are kept
+     * and written by the next flush, at the same offset. Records with variable-length string
+     * members are byteified again for that, as their strings are released after each write.
+     */
+    @Override
+    public void flush()
+    {
+        if (count == 0)
+        {
+            // Strings of a record that failed to byteify may still be in the arena.
+            releaseVLStrings();
+            return;
+        }
+        baseWriter.checkOpen();
+        type.check(baseWriter.fileId);
+        final long[] blockDimensions = new long[]
+            { count };
+        final long[] blockOffset = new long[]
+            { offset };
+        final ICallableWithCleanUp<Void> writeRunnable = new ICallableWithCleanUp<Void>()
+            {
+                @Override
+                public Void call(final ICleanUpRegistry registry)
+                {
+                    final int dataSetId =
+                            baseWriter.h5.openAndExtendDataSet(baseWriter.fileId, objectPath,
+                                    baseWriter.fileFormat, new long[]
+                                        { blockOffset[0] + blockDimensions[0] }, -1, registry);
+                    final int dataSpaceId =
+                            baseWriter.h5.getDataSpaceForDataSet(dataSetId, registry);
+                    baseWriter.h5.setHyperslabBlock(dataSpaceId, blockOffset, blockDimensions);
+                    final int memorySpaceId =
+                            baseWriter.h5.createSimpleDataSpace(blockDimensions, registry);
+                    H5Dwrite(dataSetId, type.getNativeTypeId(), memorySpaceId, dataSpaceId,
+                            H5P_DEFAULT, buffer);
+                    return null; // Nothing to return.
+                }
+            };
+        boolean written = false;
+        try
+        {
+            if (stale)
+            {
+                byteifyAgain();
+            }
+            baseWriter.runner.call(writeRunnable);
+            if (recordsOrNull != null)
+            {
+                Arrays.fill(recordsOrNull, 0, count, null);
+            }
+            offset += count;
+            count = 0;
+            written = true;
+        } finally
+        {
+            releaseVLStrings();
+            // The records that are kept refer to the released strings.
+            stale = (written == false && recordsOrNull != null);
+        }
+    }
+
+    @SuppressWarnings("unchecked")
+    private void byteifyAgain()
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            type.getObjectByteifyer().byteify(type.getStorageTypeId(), (T) recordsOrNull[i],
+                    buffer, i * recordSize, arenaOrNull);
+        }
+    }
+
+    /**
+     * Writes all buffered records to the data set and closes this appender.
+     */
+    @Override
+    public void close()
+    {
+        if (closed)
+        {
+            return;
+        }
+        try
+        {
+            flush();
+        } finally
+        {
+            closed = true;
+            baseWriter.removeFlushable(this);
+        }
+    }
+
+    private void releaseVLStrings()
+    {
+        if (arenaOrNull != null)
+        {
+            arenaOrNull.release();
+        }
+    }
+
+    private void checkOpen() throws HDF5JavaException
+    {
+        if (closed)
+        {
+            throw new HDF5JavaException("Appender for data set '" + objectPath + "' is closed.");
+        }
+    }
+
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5;
+
+import java.util.Arrays;
+
+import ncsa.hdf.hdf5lib.exceptions.HDF5JavaException;
+
+/**
+ * Selected members of a one-dimensional compound data set, read column by column.
+ * <p>
+ * Each column is a primitive array (<code>byte[]</code>, <code>short[]</code>, <code>int[]</code>,
+ * <code>long[]</code>, <code>float[]</code> or <code>double[]</code>) or a <code>String[]</code>,
+ * depending on the storage type of the compound member. Integer members are returned in the array
+ * type of their storage size; unsigned members are returned as the signed type of the same size,
+ * like everywhere else in this library.
+ *
+ * @see IHDF5CompoundReader#readColumns(String, String...)
+ * @author Bernd Rinn
+ */
+public final class HDF5CompoundColumns
+{
+    private final String[] memberNames;
+
+    private final Object[] columns;
+
+    private final int size;
+
+    HDF5CompoundColumns(String[] memberNames, Object[] columns, int size)
+    {
+        this.memberNames = memberNames;
+        this.columns = columns;
+        this.size = size;
+    }
+
+    /**
+     * Returns the names of the members read, in the order they were requested.
+     */
+    public String[] getMemberNames()
+    {
+        return memberNames.clone();
+    }
+
+    /**
+     * Returns the number of records (i.e. the length of each column).
+     */
+    public int size()
+    {
+        return size;
+    }
+
+    /**
+     * Returns the column of <var>memberName</var> as it has been read.
+     *
+     * @throws HDF5JavaException If <var>memberName</var> has not been read.
+     */
+    public Object getColumn(String memberName) throws HDF5JavaException
+    {
+        for (int i = 0; i < memberNames.length; ++i)
+        {
+            if (memberNames[i].equals(memberName))
+            {
+                return columns[i];
+            }
+        }
+        throw new HDF5JavaException("Member '" + memberName + "' has not been read (members read: "
+                + Arrays.toString(memberNames) + ").");
+    }
+
+    /**
+     * Returns the column of <var>memberName</var> as a <code>byte[]</code>.
+     *
+     * @throws HDF5JavaException If <var>memberName</var> has not been read or is not a
+     *             <code>byte[]</code> column.
+     */
+    public byte[] getByteColumn(String memberName) throws HDF5JavaException
+    {
+        return getColumn(memberName, byte[].class);
+    }
+
+    /**
+     * Returns the column of <var>memberName</var> as a <code>short[]</code>.
+     *
+     * @throws HDF5JavaException If <var>memberName</var> has not been read or is not a
+     *             <code>short[]</code> column.
+     */
+    public short[] getShortColumn(String memberName) throws HDF5JavaException
+    {
+        return getColumn(memberName, short[].class);
+    }
+
+    /**
+     * Returns the column of <var>memberName</var> as an <code>int[]</code>.
+     *
+     * @throws HDF5JavaException If <var>memberName</var> has not been read or is not an
+     *             <code>int[]</code> column.
+     */
+    public int[] getIntColumn(String memberName) throws HDF5JavaException
+    {
+        return getColumn(memberName, int[].class);
+    }
+
+    /**
+     * Returns the column of <var>memberName</var> as a <code>long[]</code>.
+     *
+     * @throws HDF5JavaException If <var>memberName</var> has not been read or is not a
+     *             <code>long[]</code> column.
+     */
+    public long[] getLongColumn(String memberName) throws HDF5JavaException
+    {
+        return getColumn(memberName, long[].class);
+    }
+
+    /**
+     * Returns the column of <var>memberName</var> as a <code>float[]</code>.
+     *
+     * @throws HDF5JavaException If <var>memberName</var> has not been read or is not a
+     *             <code>float[]</code> column.
+     */
+    public float[] getFloatColumn(String memberName) throws HDF5JavaException
+    {
+        return getColumn(memberName, float[].class);
+    }
+
+    /**
+     * Returns the column of <var>memberName</var> as a <code>double[]</code>.
+     *
+     * @throws HDF5JavaException If <var>memberName</var> has not been read or is not a
+     *             <code>double[]</code> column.
+     */
+    public double[] getDoubleColumn(String memberName) throws HDF5JavaException
+    {
+        return getColumn(memberName, double[].class);
+    }
+
+    /**
+     * Returns the column of <var>memberName</var> as a <code>String[]</code>.
+     *
+     * @throws HDF5JavaException If <var>memberName</var> has not been read or is not a
+     *             <code>String[]</code> column.
+     */
+    public String[] getStringColumn(String memberName) throws HDF5JavaException
+    {
+        return getColumn(memberName, String[].class);
+    }
+
+    private <T> T getColumn(String memberName, Class<T> columnClass) throws HDF5JavaException
+    {
+        final Object column = getColumn(memberName);
+        if (columnClass.isInstance(column) == false)
+        {
+            throw new HDF5JavaException("Member '" + memberName + "' is of type "
+                    + column.getClass().getSimpleName() + ", not "
+                    + columnClass.getSimpleName() + ".");
+        }
+        return columnClass.cast(column);
+    }
+
+    @Override
+    public String toString()
+    {
+        return "HDF5CompoundColumns [memberNames=" + Arrays.toString(memberNames) + ", size="
+                + size + "]";
+    }
+
+}
@@ -0,0 +1,437 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5;
+
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_BITFIELD;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_ENUM;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_FLOAT;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_INTEGER;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_OPAQUE;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_REFERENCE;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_STRING;
+
+import java.util.HashMap;
+import java.util.Map;
+
+import ch.systemsx.cisd.hdf5.cleanup.CleanUpRegistry;
+import ch.systemsx.cisd.hdf5.cleanup.ICleanUpRegistry;
+import ch.systemsx.cisd.hdf5.hdf5lib.HDFNativeData;
+
+/**
+ * A plan for converting the records of a compound data set from the native layout of the file's
+ * compound type to the memory layout of a {@link HDF5CompoundType} in Java.
+ * <p>
+ * If the compound type of a data set differs from the memory type, e.g. because members have been
+ * reordered, widened or added since the file was written, HDF5 converts every record with its
+ * generic compound conversion, which is much slower than reading a matching layout. A plan is
+ * computed once per data set and memory type. If it is usable, the records are read in the native
+ * layout of the file's type and the members are copied or widened to the memory layout with the
+ * pre-computed offsets. Members of the memory type that the file doesn't have are left zero.
+ * <p>
+ * Only conversions that are exact are planned: copying members of equal type, widening integers
+ * (not turning signed into unsigned), integers to floating point numbers that can represent all
+ * their values, and <code>float</code> to <code>double</code>. For all other cases, and if the
+ * layouts match anyway, the plan is not usable and the library conversion is used.
+ *
+ * @author Bernd Rinn
+ */
+final class HDF5CompoundConversionPlan
+{
+
+    private static final int COPY = 0;
+
+    private static final int INTEGER = 1;
+
+    private static final int UNSIGNED_INTEGER = 2;
+
+    private static final int INTEGER_TO_FLOAT = 3;
+
+    private static final int UNSIGNED_INTEGER_TO_FLOAT = 4;
+
+    private static final int INTEGER_TO_DOUBLE = 5;
+
+    private static final int UNSIGNED_INTEGER_TO_DOUBLE = 6;
+
+    private static final int FLOAT_TO_DOUBLE = 7;
+
+    /** The data types that this plan keeps open. */
+    private final CleanUpRegistry dataTypeRegistry;
+
+    private final int storageDataTypeId;
+
+    private final int fileNativeDataTypeId;
+
+    private final int fileRecordSize;
+
+    private final int memoryRecordSize;
+
+    private final int[] operations;
+
+    private final int[] sourceOffsets;
+
+    private final int[] sourceSizes;
+
+    private final int[] targetOffsets;
+
+    private final int[] targetSizes;
+
+    private int numberOfUsers;
+
+    private boolean closed;
+
+    private HDF5CompoundConversionPlan(CleanUpRegistry dataTypeRegistry, int storageDataTypeId,
+            int fileNativeDataTypeId, int fileRecordSize, int memoryRecordSize, int[] operations,
+            int[] sourceOffsets, int[] sourceSizes, int[] targetOffsets, int[] targetSizes)
+    {
+        this.dataTypeRegistry = dataTypeRegistry;
+        this.storageDataTypeId = storageDataTypeId;
+        this.fileNativeDataTypeId = fileNativeDataTypeId;
+        this.fileRecordSize = fileRecordSize;
+        this.memoryRecordSize = memoryRecordSize;
+        this.operations = operations;
+        this.sourceOffsets = sourceOffsets;
+        this.sourceSizes = sourceSizes;
+        this.targetOffsets = targetOffsets;
+        this.targetSizes = targetSizes;
+    }
+
+    /**
+     * Computes the plan for reading records of <var>storageDataTypeId</var> into the memory
+     * layout of <var>type</var>. The data types that the plan keeps are owned by the plan and
+     * released by {@link #close()}.
+     */
+    static HDF5CompoundConversionPlan create(HDF5 h5, int storageDataTypeId,
+            HDF5CompoundType<?> type, ICleanUpRegistry registry)
+    {
+        final CleanUpRegistry dataTypeRegistry = new CleanUpRegistry();
+        try
+        {
+            return create(h5, storageDataTypeId, type, dataTypeRegistry, registry);
+        } catch (RuntimeException ex)
+        {
+            dataTypeRegistry.cleanUp(true);
+            throw ex;
+        }
+    }
+
+    private static HDF5CompoundConversionPlan create(HDF5 h5, int storageDataTypeId,
+            HDF5CompoundType<?> type, CleanUpRegistry dataTypeRegistry, ICleanUpRegistry registry)
+    {
+        final int storageDataTypeCopyId = h5.copyDataType(storageDataTypeId, dataTypeRegistry);
+        final int fileNativeDataTypeId = h5.getNativeDataType(storageDataTypeId, registry);
+        final int memoryDataTypeId = type.getNativeTypeId();
+        if (h5.dataTypesAreEqual(fileNativeDataTypeId, memoryDataTypeId))
+        {
+            return createNotUsable(dataTypeRegistry, storageDataTypeCopyId);
+        }
+        final String[] fileMemberNames = h5.getNamesForEnumOrCompoundMembers(fileNativeDataTypeId);
+        final Map<String, Integer> fileMemberIndices = new HashMap<String, Integer>();
+        for (int i = 0; i < fileMemberNames.length; ++i)
+        {
+            fileMemberIndices.put(fileMemberNames[i], i);
+        }
+        final boolean[] fileMemberMapped = new boolean[fileMemberNames.length];
+        final int numberOfMembers = h5.getNumberOfMembers(memoryDataTypeId);
+        final int[] operations = new int[numberOfMembers];
+        final int[] sourceOffsets = new int[numberOfMembers];
+        final int[] sourceSizes = new int[numberOfMembers];
+        final int[] targetOffsets = new int[numberOfMembers];
+        final int[] targetSizes = new int[numberOfMembers];
+        int numberOfOperations = 0;
+        for (int i = 0; i < numberOfMembers; ++i)
+        {
+            final Integer fileIndexOrNull =
+                    fileMemberIndices.get(h5.getNameForEnumOrCompoundMemberIndex(
+                            memoryDataTypeId, i));
+            if (fileIndexOrNull == null)
+            {
+                // Member not in file: keep it zero.
+                continue;
+            }
+            final int fileIndex = fileIndexOrNull;
+            final int sourceTypeId =
+                    h5.getDataTypeForIndex(fileNativeDataTypeId, fileIndex, registry);
+            final int targetTypeId = h5.getDataTypeForIndex(memoryDataTypeId, i, registry);
+            final int operation = tryGetOperation(h5, sourceTypeId, targetTypeId);
+            if (operation < 0)
+            {
+                return createNotUsable(dataTypeRegistry, storageDataTypeCopyId);
+            }
+            fileMemberMapped[fileIndex] = true;
+            operations[numberOfOperations] = operation;
+            sourceOffsets[numberOfOperations] =
+                    h5.getOffsetForCompoundMemberIndex(fileNativeDataTypeId, fileIndex);
+            sourceSizes[numberOfOperations] = h5.getDataTypeSize(sourceTypeId);
+            targetOffsets[numberOfOperations] =
+                    h5.getOffsetForCompoundMemberIndex(memoryDataTypeId, i);
+            targetSizes[numberOfOperations] = h5.getDataTypeSize(targetTypeId);
+            ++numberOfOperations;
+        }
+        // Members that are not read must not hold memory that needs to be reclaimed.
+        for (int i = 0; i < fileMemberNames.length; ++i)
+        {
+            if (fileMemberMapped[i] == false
+                    && isPlainData(h5,
+                            h5.getDataTypeForIndex(fileNativeDataTypeId, i, registry)) == false)
+            {
+                return createNotUsable(dataTypeRegistry, storageDataTypeCopyId);
+            }
+        }
+        return new HDF5CompoundConversionPlan(dataTypeRegistry, storageDataTypeCopyId,
+                h5.getNativeDataType(storageDataTypeId, dataTypeRegistry),
+                h5.getDataTypeSize(fileNativeDataTypeId), type.getRecordSizeInMemory(), trim(
+                        operations, numberOfOperations), trim(sourceOffsets, numberOfOperations),
+                trim(sourceSizes, numberOfOperations), trim(targetOffsets, numberOfOperations),
+                trim(targetSizes, numberOfOperations));
+    }
+
+    private static HDF5CompoundConversionPlan createNotUsable(CleanUpRegistry dataTypeRegistry,
+            int storageDataTypeId)
+    {
+        return new HDF5CompoundConversionPlan(dataTypeRegistry, storageDataTypeId, -1, -1, -1,
+                null, null, null, null, null);
+    }
+
+    private static int tryGetOperation(HDF5 h5, int sourceTypeId, int targetTypeId)
+    {
+        final int sourceClass = h5.getClassType(sourceTypeId);
+        final int targetClass = h5.getClassType(targetTypeId);
+        if (sourceClass == targetClass && h5.dataTypesAreEqual(sourceTypeId, targetTypeId))
+        {
+            return COPY;
+        }
+        if (sourceClass != H5T_INTEGER && sourceClass != H5T_FLOAT)
+        {
+            return -1;
+        }
+        final int sourceSize = h5.getDataTypeSize(sourceTypeId);
+        final int targetSize = h5.getDataTypeSize(targetTypeId);
+        if (sourceClass == H5T_FLOAT)
+        {
+            return (targetClass == H5T_FLOAT && sourceSize == 4 && targetSize == 8) ?
+                    FLOAT_TO_DOUBLE : -1;
+        }
+        final boolean sourceSigned = h5.getSigned(sourceTypeId);
+        if (targetClass == H5T_INTEGER)
+        {
+            if (targetSize <= sourceSize || (sourceSigned && h5.getSigned(targetTypeId) == false))
+            {
+                return -1;
+            }
+            return sourceSigned ? INTEGER : UNSIGNED_INTEGER;
+        }
+        if (targetClass == H5T_FLOAT)
+        {
+            // Only conversions where the mantissa can hold all values.
+            if (targetSize == 4 && sourceSize <= 2)
+            {
+                return sourceSigned ? INTEGER_TO_FLOAT : UNSIGNED_INTEGER_TO_FLOAT;
+            }
+            if (targetSize == 8 && sourceSize <= 4)
+            {
+                return sourceSigned ? INTEGER_TO_DOUBLE : UNSIGNED_INTEGER_TO_DOUBLE;
+            }
+        }
+        return -1;
+    }
+
+    private static boolean isPlainData(HDF5 h5, int dataTypeId)
+    {
+        final int dataClass = h5.getClassType(dataTypeId);
+        if (dataClass == H5T_STRING)
+        {
+            return h5.isVariableLengthString(dataTypeId) == false;
+        }
+        return dataClass == H5T_INTEGER || dataClass == H5T_FLOAT || dataClass == H5T_ENUM
+                || dataClass == H5T_BITFIELD || dataClass == H5T_OPAQUE
+                || dataClass == H5T_REFERENCE;
+    }
+
+    private static int[] trim(int[] array, int length)
+    {
+        final int[] result = new int[length];
+        System.arraycopy(array, 0, result, 0, length);
+        return result;
+    }
+
+    /**
+     * Returns <code>true</code>, if this plan was computed for a data set with a compound type
+     * equal to <var>dataTypeId</var>.
+     */
+    boolean appliesTo(HDF5 h5, int dataTypeId)
+    {
+        return h5.dataTypesAreEqual(storageDataTypeId, dataTypeId);
+    }
+
+    /**
+     * Returns <code>true</code>, if the records can be converted with this plan,
+     * <code>false</code>, if the library conversion needs to be used.
+     */
+    boolean isUsable()
+    {
+        return operations != null;
+    }
+
+    /**
+     * Marks this plan as being used for a read. Returns <code>false</code>, if the plan has
+     * already been closed and can't be used anymore.
+     */
+    synchronized boolean tryAcquire()
+    {
+        if (closed)
+        {
+            return false;
+        }
+        ++numberOfUsers;
+        return true;
+    }
+
+    /**
+     * Marks a read that has called {@link #tryAcquire()} as done.
+     */
+    synchronized void release()
+    {
+        --numberOfUsers;
+        if (closed && numberOfUsers == 0)
+        {
+            dataTypeRegistry.cleanUp(false);
+        }
+    }
+
+    /**
+     * Closes the data types of this plan, once the reads that use it are done. To be called when
+     * the plan is dropped from the cache.
+     */
+    synchronized void close()
+    {
+        if (closed)
+        {
+            return;
+        }
+        closed = true;
+        if (numberOfUsers == 0)
+        {
+            dataTypeRegistry.cleanUp(false);
+        }
+    }
+
+    /**
+     * Returns the data type to read the records with, before calling {@link #convert(byte[], int)}
+     * .
+     */
+    int getFileNativeDataTypeId()
+    {
+        return fileNativeDataTypeId;
+    }
+
+    /**
+     * Returns the size of a record in the native layout of the file's compound type.
+     */
+    int getFileRecordSize()
+    {
+        return fileRecordSize;
+    }
+
+    /**
+     * Converts <var>numberOfRecords</var> records in <var>fileRecords</var> from the native
+     * layout of the file's compound type to the memory layout.
+     */
+    byte[] convert(byte[] fileRecords, int numberOfRecords)
+    {
+        final byte[] records = new byte[numberOfRecords * memoryRecordSize];
+        int sourceRecordOffset = 0;
+        int targetRecordOffset = 0;
+        for (int r = 0; r < numberOfRecords; ++r)
+        {
+            for (int i = 0; i < operations.length; ++i)
+            {
+                final int sourceOffset = sourceRecordOffset + sourceOffsets[i];
+                final int targetOffset = targetRecordOffset + targetOffsets[i];
+                switch (operations[i])
+                {
+                    case COPY:
+                        System.arraycopy(fileRecords, sourceOffset, records, targetOffset,
+                                sourceSizes[i]);
+                        break;
+                    case INTEGER:
+                    case UNSIGNED_INTEGER:
+                        putInteger(records, targetOffset, targetSizes[i],
+                                getInteger(fileRecords, sourceOffset, sourceSizes[i],
+                                        operations[i] == INTEGER));
+                        break;
+                    case INTEGER_TO_FLOAT:
+                    case UNSIGNED_INTEGER_TO_FLOAT:
+                        HDFNativeData.floatToByte(
+                                getInteger(fileRecords, sourceOffset, sourceSizes[i],
+                                        operations[i] == INTEGER_TO_FLOAT), records, targetOffset);
+                        break;
+                    case INTEGER_TO_DOUBLE:
+                    case UNSIGNED_INTEGER_TO_DOUBLE:
+                        HDFNativeData.doubleToByte(
+                                getInteger(fileRecords, sourceOffset, sourceSizes[i],
+                                        operations[i] == INTEGER_TO_DOUBLE), records, targetOffset);
+                        break;
+                    case FLOAT_TO_DOUBLE:
+                        HDFNativeData.doubleToByte(
+                                HDFNativeData.byteToFloat(fileRecords, sourceOffset), records,
+                                targetOffset);
+                        break;
+                    default:
+                        throw new Error("Unknown conversion operation " + operations[i]);
+                }
+            }
+            sourceRecordOffset += fileRecordSize;
+            targetRecordOffset += memoryRecordSize;
+        }
+        return records;
+    }
+
+    private static long getInteger(byte[] byteArr, int offset, int size, boolean signed)
+    {
+        switch (size)
+        {
+            case 1:
+                return signed ? byteArr[offset] : (byteArr[offset] & 0xffL);
+            case 2:
+                final short s = HDFNativeData.byteToShort(byteArr, offset);
+                return signed ? s : (s & 0xffffL);
+            case 4:
+                final int i = HDFNativeData.byteToInt(byteArr, offset);
+                return signed ? i : (i & 0xffffffffL);
+            default:
+                // Can only be the source of a conversion to floating point, which is not planned.
+                return HDFNativeData.byteToLong(byteArr, offset);
+        }
+    }
+
+    private static void putInteger(byte[] byteArr, int offset, int size, long value)
+    {
+        switch (size)
+        {
+            case 2:
+                HDFNativeData.shortToByte((short) value, byteArr, offset);
+                break;
+            case 4:
+                HDFNativeData.intToByte((int) value, byteArr, offset);
+                break;
+            default:
+                HDFNativeData.longToByte(value, byteArr, offset);
+                break;
+        }
+    }
+
+}
@@ -0,0 +1,378 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5;
+
+import java.util.Arrays;
+
+import ncsa.hdf.hdf5lib.exceptions.HDF5JavaException;
+
+import ch.systemsx.cisd.hdf5.HDF5BaseReader.DataSpaceParameters;
+import ch.systemsx.cisd.hdf5.cleanup.ICallableWithCleanUp;
+import ch.systemsx.cisd.hdf5.cleanup.ICleanUpRegistry;
+import ch.systemsx.cisd.hdf5.hdf5lib.HDFNativeData;
+
+/**
+ * A cursor over the records of a one-dimensional compound data set that gives access to the
+ * members of the current record by member index, without creating an object per record.
+ * <p>
+ * The records are read block-wise into one re-used buffer in the memory layout of the compound
+ * type. The getters decode a member directly from this buffer. A member index is the index of the
+ * member in the compound type, see {@link #getMemberIndex(String)}. The pattern for using this
+ * class is:
+ *
+ * <pre>
+ * final HDF5CompoundCursor cursor = reader.compound().getCursor(&quot;/events&quot;, eventType);
+ * try
+ * {
+ *     final int valueIdx = cursor.getMemberIndex(&quot;value&quot;);
+ *     while (cursor.next())
+ *     {
+ *         sum += cursor.getDouble(valueIdx);
+ *     }
+ * } finally
+ * {
+ *     cursor.close();
+ * }
+ * </pre>
+ * <p>
+ * <i>This class is not thread-safe.</i>
+ *
+ * @author Bernd Rinn
+ */
+public final class HDF5CompoundCursor implements AutoCloseable
+{
+
+    /** The default number of records read in one block. */
+    public static final int DEFAULT_BLOCK_SIZE = 4096;
+
+    private final HDF5BaseReader baseReader;
+
+    private final String objectPath;
+
+    private final HDF5CompoundType<?> type;
+
+    private final HDF5MemberByteifyer[] byteifyers;
+
+    private final int recordSize;
+
+    private final int blockSize;
+
+    private final boolean hasVLMembers;
+
+    private final long size;
+
+    private final byte[] buffer;
+
+    private long blockOffset;
+
+    private int blockLength;
+
+    private int indexInBlock = -1;
+
+    private int recordOffset = -1;
+
+    private boolean closed;
+
+    HDF5CompoundCursor(HDF5BaseReader baseReader, String objectPath, HDF5CompoundType<?> type,
+            long size, int blockSize)
+    {
+        if (blockSize < 1)
+        {
+            throw new IllegalArgumentException("Block size needs to be >= 1, found: " + blockSize);
+        }
+        this.baseReader = baseReader;
+        this.objectPath = objectPath;
+        this.type = type;
+        this.byteifyers = type.getObjectByteifyer().getByteifyers();
+        this.recordSize = type.getObjectByteifyer().getRecordSizeInMemory();
+        final long effectiveBlockSize = Math.max(1, Math.min(blockSize, size));
+        if (effectiveBlockSize * recordSize > Integer.MAX_VALUE)
+        {
+            throw new IllegalArgumentException("Block size " + blockSize
+                    + " is too large for records of " + recordSize + " bytes.");
+        }
+        this.blockSize = (int) effectiveBlockSize;
+        this.hasVLMembers = type.getObjectByteifyer().getVLMemberIndices().length > 0;
+        this.size = size;
+        this.buffer = new byte[this.blockSize * recordSize];
+    }
+
+    /**
+     * Returns the path of the data set that this cursor reads.
+     */
+    public String getObjectPath()
+    {
+        return objectPath;
+    }
+
+    /**
+     * Returns the number of records of the data set.
+     */
+    public long size()
+    {
+        return size;
+    }
+
+    /**
+     * Returns the number of members of a record.
+     */
+    public int getNumberOfMembers()
+    {
+        return byteifyers.length;
+    }
+
+    /**
+     * Returns the index of member <var>memberName</var>.
+     *
+     * @throws HDF5JavaException If the compound type has no member <var>memberName</var>.
+     */
+    public int getMemberIndex(String memberName) throws HDF5JavaException
+    {
+        for (int i = 0; i < byteifyers.length; ++i)
+        {
+            if (byteifyers[i].getMemberName().equals(memberName))
+            {
+                return i;
+            }
+        }
+        throw new HDF5JavaException("Compound type " + type.getName() + " has no member '"
+                + memberName + "'.");
+    }
+
+    /**
+     * Moves the cursor to the next record, reading the next block if needed.
+     *
+     * @return <code>true</code>, if there is a next record, <code>false</code>, if the cursor has
+     *         reached the end of the data set.
+     */
+    public boolean next()
+    {
+        checkOpen();
+        if (indexInBlock + 1 < blockLength)
+        {
+            ++indexInBlock;
+            recordOffset += recordSize;
+            return true;
+        }
+        final long nextBlockOffset = blockOffset + blockLength;
+        recordOffset = -1;
+        if (nextBlockOffset >= size)
+        {
+            return false;
+        }
+        readBlock(nextBlockOffset);
+        indexInBlock = 0;
+        recordOffset = 0;
+        return true;
+    }
+
+    /**
+     * Returns the index of the current record in the data set.
+     */
+    public long getIndex()
+    {
+        checkRecord();
+        return blockOffset + indexInBlock;
+    }
+
+    /**
+     * Returns the buffer that holds the current block of records in the memory layout of the
+     * compound type. The buffer is overwritten when the next block is read.
+     */
+    public byte[] getBuffer()
+    {
+        return buffer;
+    }
+
+    /**
+     * Returns the offset of the current record in {@link #getBuffer()}.
+     */
+    public int getRecordOffset()
+    {
+        checkRecord();
+        return recordOffset;
+    }
+
+    /**
+     * Returns the offset of member <var>memberIndex</var> within a record.
+     */
+    public int getMemberOffset(int memberIndex)
+    {
+        return byteifyers[memberIndex].getOffsetInMemory();
+    }
+
+    /**
+     * Returns the value of the <code>boolean</code> member <var>memberIndex</var> of the current
+     * record.
+     */
+    public boolean getBoolean(int memberIndex) throws HDF5JavaException
+    {
+        return buffer[offsetOf(memberIndex, 1, "boolean")] != 0;
+    }
+
+    /**
+     * Returns the value of the <code>byte</code> member <var>memberIndex</var> of the current
+     * record.
+     */
+    public byte getByte(int memberIndex) throws HDF5JavaException
+    {
+        return buffer[offsetOf(memberIndex, 1, "byte")];
+    }
+
+    /**
+     * Returns the value of the <code>short</code> member <var>memberIndex</var> of the current
+     * record.
+     */
+    public short getShort(int memberIndex) throws HDF5JavaException
+    {
+        return HDFNativeData.byteToShort(buffer, offsetOf(memberIndex, 2, "short"));
+    }
+
+    /**
+     * Returns the value of the <code>int</code> member <var>memberIndex</var> of the current
+     * record.
+     */
+    public int getInt(int memberIndex) throws HDF5JavaException
+    {
+        return HDFNativeData.byteToInt(buffer, offsetOf(memberIndex, 4, "int"));
+    }
+
+    /**
+     * Returns the value of the <code>long</code> member <var>memberIndex</var> of the current
+     * record.
+     */
+    public long getLong(int memberIndex) throws HDF5JavaException
+    {
+        return HDFNativeData.byteToLong(buffer, offsetOf(memberIndex, 8, "long"));
+    }
+
+    /**
+     * Returns the value of the <code>float</code> member <var>memberIndex</var> of the current
+     * record.
+     */
+    public float getFloat(int memberIndex) throws HDF5JavaException
+    {
+        return HDFNativeData.byteToFloat(buffer, offsetOf(memberIndex, 4, "float"));
+    }
+
+    /**
+     * Returns the value of the <code>double</code> member <var>memberIndex</var> of the current
+     * record.
+     */
+    public double getDouble(int memberIndex) throws HDF5JavaException
+    {
+        return HDFNativeData.byteToDouble(buffer, offsetOf(memberIndex, 8, "double"));
+    }
+
+    /**
+     * Returns the value of the <code>String</code> member <var>memberIndex</var> of the current
+     * record. This is the only getter that creates an object.
+     */
+    public String getString(int memberIndex) throws HDF5JavaException
+    {
+        checkRecord();
+        final HDF5MemberByteifyer byteifyer = byteifyers[memberIndex];
+        if (byteifyer.isString() == false)
+        {
+            throw new HDF5JavaException("Compound " + byteifyer.describe()
+                    + " is not a string member and cannot be read as String.");
+        }
+        final int offset = recordOffset + byteifyer.getOffsetInMemory();
+        if (byteifyer.isVariableLengthType())
+        {
+            return HDFNativeData.createVLStrFromCompound(buffer, offset);
+        }
+        return StringUtils.fromBytes0Term(buffer, offset, offset + byteifyer.getSize(),
+                byteifyer.getCharacterEncoding());
+    }
+
+    /**
+     * Closes this cursor and releases the variable-length members of the current block.
+     */
+    @Override
+    public void close()
+    {
+        if (closed)
+        {
+            return;
+        }
+        closed = true;
+        reclaimVL();
+    }
+
+    private int offsetOf(int memberIndex, int expectedSize, String javaType)
+            throws HDF5JavaException
+    {
+        checkRecord();
+        final HDF5MemberByteifyer byteifyer = byteifyers[memberIndex];
+        if (byteifyer.getSize() != expectedSize || byteifyer.isVariableLengthType())
+        {
+            throw new HDF5JavaException("Compound " + byteifyer.describe() + " of size "
+                    + byteifyer.getSize() + " cannot be read as " + javaType + ".");
+        }
+        return recordOffset + byteifyer.getOffsetInMemory();
+    }
+
+    private void readBlock(final long offset)
+    {
+        reclaimVL();
+        final ICallableWithCleanUp<Integer> readRunnable = new ICallableWithCleanUp<Integer>()
+            {
+                @Override
+                public Integer call(final ICleanUpRegistry registry)
+                {
+                    final int dataSetId =
+                            baseReader.h5.openDataSet(baseReader.fileId, objectPath, registry);
+                    final DataSpaceParameters spaceParams =
+                            baseReader.getSpaceParameters(dataSetId, offset, blockSize, registry);
+                    baseReader.h5.readDataSet(dataSetId, type.getNativeTypeId(),
+                            spaceParams.memorySpaceId, spaceParams.dataSpaceId, buffer);
+                    return spaceParams.blockSize;
+                }
+            };
+        blockLength = 0;
+        blockOffset = offset;
+        blockLength = baseReader.runner.call(readRunnable);
+    }
+
+    private void reclaimVL()
+    {
+        if (hasVLMembers && blockLength > 0)
+        {
+            baseReader.h5.reclaimCompoundVL(type, buffer);
+            // Records of a shorter last block must not free the pointers of this block again.
+            Arrays.fill(buffer, (byte) 0);
+        }
+    }
+
+    private void checkRecord()
+    {
+        if (recordOffset < 0)
+        {
+            throw new IllegalStateException("Cursor is not positioned on a record, call next().");
+        }
+    }
+
+    private void checkOpen()
+    {
+        if (closed)
+        {
+            throw new HDF5JavaException("Cursor on data set '" + objectPath + "' is closed.");
+        }
+    }
+
+}
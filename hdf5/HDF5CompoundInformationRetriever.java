@@ -29,6 +29,7 @@ import org.apache.commons.lang.StringUtils;
 
 import ncsa.hdf.hdf5lib.exceptions.HDF5JavaException;
 
+import ch.systemsx.cisd.hdf5.HDF5CompoundTypeCache.Origin;
 import ch.systemsx.cisd.hdf5.HDF5DataTypeInformation.DataTypeInfoOptions;
 import ch.systemsx.cisd.hdf5.cleanup.ICallableWithCleanUp;
 import ch.systemsx.cisd.hdf5.cleanup.ICleanUpRegistry;
@@ -355,12 +356,30 @@ abstract class HDF5CompoundInformationRetriever implements IHDF5CompoundInformat
     public <T> HDF5CompoundType<T> getInferredType(String name, Class<T> pojoClass,
             HDF5CompoundMappingHints hints, boolean requireTypesToBeEqual)
     {
-        return getType(
-                name,
-                pojoClass,
-                requireTypesToBeEqual,
-                addEnumTypes(HDF5CompoundMemberMapping.addHints(
-                        HDF5CompoundMemberMapping.inferMapping(pojoClass), hints)));
+        baseReader.checkOpen();
+        final Origin origin =
+                isCommittingInferredTypes() ? Origin.INFERRED_COMMITTED : Origin.INFERRED;
+        final HDF5CompoundTypeCache.Key key =
+                new HDF5CompoundTypeCache.Key(origin, name, pojoClass, hints, null,
+                        requireTypesToBeEqual);
+        final HDF5CompoundType<T> cachedTypeOrNull = baseReader.compoundTypeCache.tryGet(key);
+        if (cachedTypeOrNull != null)
+        {
+            return cachedTypeOrNull;
+        }
+        return baseReader.compoundTypeCache.put(
+                key,
+                getType(name, pojoClass, requireTypesToBeEqual,
+                        addEnumTypes(HDF5CompoundMemberMapping.addHints(
+                                HDF5CompoundMemberMapping.inferMapping(pojoClass), hints))));
+    }
+
+    /**
+     * Returns <code>true</code>, if types inferred by this retriever are committed to the file.
+     */
+    boolean isCommittingInferredTypes()
+    {
+        return false;
     }
 
     @Override
@@ -635,6 +654,13 @@ abstract class HDF5CompoundInformationRetriever implements IHDF5CompoundInformat
             HDF5CompoundMappingHints hints, boolean requireTypesToBeEqual)
     {
         baseReader.checkOpen();
+        final HDF5CompoundTypeCache.Key key =
+                getDataSetTypeKey(objectPath, pojoClass, hints, requireTypesToBeEqual);
+        final HDF5CompoundType<T> cachedTypeOrNull = tryGetCachedDataSetType(objectPath, key);
+        if (cachedTypeOrNull != null)
+        {
+            return cachedTypeOrNull;
+        }
         // We need to get ALL information for the type as otherwise the mapping might be wrong (due
         // to a missing data type variant).
         final CompoundTypeInformation cpdTypeInfo =
@@ -643,7 +669,64 @@ abstract class HDF5CompoundInformationRetriever implements IHDF5CompoundInformat
         final HDF5CompoundType<T> typeForClass =
                 getType(cpdTypeInfo.name, cpdTypeInfo.compoundDataTypeId, pojoClass,
                         requireTypesToBeEqual, createByteifyers(pojoClass, cpdTypeInfo, hints));
-        return typeForClass;
+        return baseReader.compoundTypeCache.put(key, typeForClass);
+    }
+
+    /**
+     * Returns the cache key for the type of data set <var>objectPath</var>. If the data set has a
+     * committed data type, the key refers to the committed data type, so that all data sets of
+     * this type share the cached compound type.
+     */
+    private HDF5CompoundTypeCache.Key getDataSetTypeKey(final String objectPath,
+            final Class<?> pojoClass, final HDF5CompoundMappingHints hints,
+            final boolean requireTypesToBeEqual)
+    {
+        final ICallableWithCleanUp<String> pathRunnable = new ICallableWithCleanUp<String>()
+            {
+                @Override
+                public String call(final ICleanUpRegistry registry)
+                {
+                    final int dataSetId =
+                            baseReader.h5.openDataSet(baseReader.fileId, objectPath, registry);
+                    final int dataTypeId =
+                            baseReader.h5.getDataTypeForDataSet(dataSetId, registry);
+                    return baseReader.tryGetDataTypePath(dataTypeId);
+                }
+            };
+        final String dataTypePathOrNull = baseReader.runner.call(pathRunnable);
+        return (dataTypePathOrNull != null) ? new HDF5CompoundTypeCache.Key(Origin.COMMITTED,
+                dataTypePathOrNull, pojoClass, hints, DataTypeInfoOptions.ALL,
+                requireTypesToBeEqual) : new HDF5CompoundTypeCache.Key(Origin.DATA_SET,
+                objectPath, pojoClass, hints, DataTypeInfoOptions.ALL, requireTypesToBeEqual);
+    }
+
+    /**
+     * Returns the cached type for <var>key</var>, or <code>null</code>, if there is none. An
+     * anonymous data set type is only returned if the data set has not been re-created with a
+     * different type since.
+     */
+    private <T> HDF5CompoundType<T> tryGetCachedDataSetType(final String objectPath,
+            final HDF5CompoundTypeCache.Key key)
+    {
+        final HDF5CompoundType<T> cachedTypeOrNull = baseReader.compoundTypeCache.tryGet(key);
+        if (cachedTypeOrNull == null || key.getOrigin() != Origin.DATA_SET)
+        {
+            return cachedTypeOrNull;
+        }
+        final ICallableWithCleanUp<Boolean> checkRunnable = new ICallableWithCleanUp<Boolean>()
+            {
+                @Override
+                public Boolean call(final ICleanUpRegistry registry)
+                {
+                    final int dataSetId =
+                            baseReader.h5.openDataSet(baseReader.fileId, objectPath, registry);
+                    final int dataTypeId =
+                            baseReader.h5.getDataTypeForDataSet(dataSetId, registry);
+                    return baseReader.h5.dataTypesAreEqual(dataTypeId,
+                            cachedTypeOrNull.getStorageTypeId());
+                }
+            };
+        return baseReader.runner.call(checkRunnable) ? cachedTypeOrNull : null;
     }
 
     @Override
@@ -728,16 +811,25 @@ abstract class HDF5CompoundInformationRetriever implements IHDF5CompoundInformat
             HDF5CompoundMappingHints hints, DataTypeInfoOptions dataTypeInfoOptions,
             boolean requireTypesToBeEqual)
     {
+        baseReader.checkOpen();
         final String dataTypePath =
                 HDF5Utils.createDataTypePath(HDF5Utils.COMPOUND_PREFIX,
                         baseReader.houseKeepingNameSuffix, dataTypeName);
+        final HDF5CompoundTypeCache.Key key =
+                new HDF5CompoundTypeCache.Key(Origin.COMMITTED, dataTypePath, pojoClass, hints,
+                        dataTypeInfoOptions, requireTypesToBeEqual);
+        final HDF5CompoundType<T> cachedTypeOrNull = baseReader.compoundTypeCache.tryGet(key);
+        if (cachedTypeOrNull != null)
+        {
+            return cachedTypeOrNull;
+        }
         final CompoundTypeInformation cpdTypeInfo =
                 getFullCompoundDataTypeInformation(dataTypePath, dataTypeInfoOptions,
                         baseReader.fileRegistry);
         final HDF5CompoundType<T> typeForClass =
                 getType(dataTypeName, cpdTypeInfo.compoundDataTypeId, pojoClass,
                         requireTypesToBeEqual, createByteifyers(pojoClass, cpdTypeInfo, hints));
-        return typeForClass;
+        return baseReader.compoundTypeCache.put(key, typeForClass);
     }
 
     private <T> HDF5ValueObjectByteifyer<T> createByteifyers(final Class<T> compoundClazz,
@@ -103,6 +103,14 @@ public class HDF5CompoundMappingHints
         return enumerationTypeMap.get(memberName);
     }
 
+    /**
+     * Returns the enum type mapping of this hints object, or <code>null</code>, if there is none.
+     */
+    Map<String, HDF5EnumerationType> tryGetEnumTypeMapping()
+    {
+        return enumerationTypeMap;
+    }
+
     /**
      * Returns the desired enumeration return type.
      */
@@ -212,6 +212,32 @@ class HDF5CompoundMemberByteifyerByteFactory implements IHDF5CompoundMemberBytif
                     }
                 }
 
+                @Override
+                boolean byteifyInto(int compoundDataTypeId, Object obj, byte[] byteArr,
+                        int arrayOffset) throws IllegalAccessException
+                {
+                    switch (rank)
+                    {
+                        case SCALAR:
+                            byteArr[arrayOffset + offsetInMemory] = field.getByte(obj);
+                            return true;
+                        case ARRAY1D:
+                        {
+                            final byte[] array = (byte[]) field.get(obj);
+                            if (array.length > len)
+                            {
+                                // Leave it to byteify() to complain.
+                                return false;
+                            }
+                            System.arraycopy(array, 0, byteArr, arrayOffset + offsetInMemory,
+                                    array.length);
+                            return true;
+                        }
+                        default:
+                            return false;
+                    }
+                }
+
                 @Override
                 public void setFromByteArray(int compoundDataTypeId, Object obj, byte[] byteArr,
                         int arrayOffset) throws IllegalAccessException
@@ -210,6 +210,33 @@ class HDF5CompoundMemberByteifyerDoubleFactory implements IHDF5CompoundMemberByt
                     }
                 }
 
+                @Override
+                boolean byteifyInto(int compoundDataTypeId, Object obj, byte[] byteArr,
+                        int arrayOffset) throws IllegalAccessException
+                {
+                    switch (rank)
+                    {
+                        case SCALAR:
+                            HDFNativeData.doubleToByte(field.getDouble(obj), byteArr, arrayOffset
+                                    + offsetInMemory);
+                            return true;
+                        case ARRAY1D:
+                        {
+                            final double[] array = (double[]) field.get(obj);
+                            if (array.length > len)
+                            {
+                                // Leave it to byteify() to complain.
+                                return false;
+                            }
+                            HDFNativeData.doubleToByte(array, byteArr, arrayOffset
+                                    + offsetInMemory);
+                            return true;
+                        }
+                        default:
+                            return false;
+                    }
+                }
+
                 @Override
                 public void setFromByteArray(int compoundDataTypeId, Object obj, byte[] byteArr,
                         int arrayOffset) throws IllegalAccessException
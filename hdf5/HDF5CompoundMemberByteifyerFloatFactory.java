@@ -209,6 +209,32 @@ class HDF5CompoundMemberByteifyerFloatFactory implements IHDF5CompoundMemberByti
                     }
                 }
 
+                @Override
+                boolean byteifyInto(int compoundDataTypeId, Object obj, byte[] byteArr,
+                        int arrayOffset) throws IllegalAccessException
+                {
+                    switch (rank)
+                    {
+                        case SCALAR:
+                            HDFNativeData.floatToByte(field.getFloat(obj), byteArr, arrayOffset
+                                    + offsetInMemory);
+                            return true;
+                        case ARRAY1D:
+                        {
+                            final float[] array = (float[]) field.get(obj);
+                            if (array.length > len)
+                            {
+                                // Leave it to byteify() to complain.
+                                return false;
+                            }
+                            HDFNativeData.floatToByte(array, byteArr, arrayOffset + offsetInMemory);
+                            return true;
+                        }
+                        default:
+                            return false;
+                    }
+                }
+
                 @Override
                 public void setFromByteArray(int compoundDataTypeId, Object obj, byte[] byteArr,
                         int arrayOffset) throws IllegalAccessException
@@ -213,6 +213,32 @@ class HDF5CompoundMemberByteifyerIntFactory implements IHDF5CompoundMemberBytify
                     }
                 }
 
+                @Override
+                boolean byteifyInto(int compoundDataTypeId, Object obj, byte[] byteArr,
+                        int arrayOffset) throws IllegalAccessException
+                {
+                    switch (rank)
+                    {
+                        case SCALAR:
+                            HDFNativeData.intToByte(field.getInt(obj), byteArr, arrayOffset
+                                    + offsetInMemory);
+                            return true;
+                        case ARRAY1D:
+                        {
+                            final int[] array = (int[]) field.get(obj);
+                            if (array.length > len)
+                            {
+                                // Leave it to byteify() to complain.
+                                return false;
+                            }
+                            HDFNativeData.intToByte(array, byteArr, arrayOffset + offsetInMemory);
+                            return true;
+                        }
+                        default:
+                            return false;
+                    }
+                }
+
                 @Override
                 public void setFromByteArray(int compoundDataTypeId, Object obj, byte[] byteArr,
                         int arrayOffset) throws IllegalAccessException
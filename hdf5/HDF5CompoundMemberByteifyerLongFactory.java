@@ -213,6 +213,32 @@ class HDF5CompoundMemberByteifyerLongFactory implements IHDF5CompoundMemberBytif
                     }
                 }
 
+                @Override
+                boolean byteifyInto(int compoundDataTypeId, Object obj, byte[] byteArr,
+                        int arrayOffset) throws IllegalAccessException
+                {
+                    switch (rank)
+                    {
+                        case SCALAR:
+                            HDFNativeData.longToByte(field.getLong(obj), byteArr, arrayOffset
+                                    + offsetInMemory);
+                            return true;
+                        case ARRAY1D:
+                        {
+                            final long[] array = (long[]) field.get(obj);
+                            if (array.length > len)
+                            {
+                                // Leave it to byteify() to complain.
+                                return false;
+                            }
+                            HDFNativeData.longToByte(array, byteArr, arrayOffset + offsetInMemory);
+                            return true;
+                        }
+                        default:
+                            return false;
+                    }
+                }
+
                 @Override
                 public void setFromByteArray(int compoundDataTypeId, Object obj, byte[] byteArr,
                         int arrayOffset) throws IllegalAccessException
@@ -213,6 +213,32 @@ class HDF5CompoundMemberByteifyerShortFactory implements IHDF5CompoundMemberByti
                     }
                 }
 
+                @Override
+                boolean byteifyInto(int compoundDataTypeId, Object obj, byte[] byteArr,
+                        int arrayOffset) throws IllegalAccessException
+                {
+                    switch (rank)
+                    {
+                        case SCALAR:
+                            HDFNativeData.shortToByte(field.getShort(obj), byteArr, arrayOffset
+                                    + offsetInMemory);
+                            return true;
+                        case ARRAY1D:
+                        {
+                            final short[] array = (short[]) field.get(obj);
+                            if (array.length > len)
+                            {
+                                // Leave it to byteify() to complain.
+                                return false;
+                            }
+                            HDFNativeData.shortToByte(array, byteArr, arrayOffset + offsetInMemory);
+                            return true;
+                        }
+                        default:
+                            return false;
+                    }
+                }
+
                 @Override
                 public void setFromByteArray(int compoundDataTypeId, Object obj, byte[] byteArr,
                         int arrayOffset) throws IllegalAccessException
@@ -44,12 +44,24 @@ class HDF5CompoundMemberByteifyerStringFactory implements IHDF5CompoundMemberByt
 
     private static abstract class HDF5StringMemberByteifyer extends HDF5MemberByteifyer
     {
+        private final boolean isReferenceType;
+
         HDF5StringMemberByteifyer(Field fieldOrNull, String memberName, int size, int offset,
                 int memOffset, CharacterEncoding encoding, int maxCharacters,
                 boolean isVariableLengthType, boolean isReferenceType)
         {
             super(fieldOrNull, memberName, size, offset, memOffset, encoding, maxCharacters,
                     isVariableLengthType, isReferenceType);
+            this.isReferenceType = isReferenceType;
+        }
+
+        /**
+         * References are mapped to strings, too, but are not stored as strings.
+         */
+        @Override
+        boolean isString()
+        {
+            return isReferenceType == false;
         }
 
         /**
@@ -73,6 +85,23 @@ class HDF5CompoundMemberByteifyerStringFactory implements IHDF5CompoundMemberByt
         {
             return -1;
         }
+
+        @Override
+        boolean byteifyInto(Object obj, byte[] byteArr, int arrayOffset, HDF5VLStringArena arena)
+                throws IllegalAccessException
+        {
+            if (isVariableLengthType() == false)
+            {
+                return false;
+            }
+            arena.copyInto(getString(obj), byteArr, arrayOffset + offsetInMemory);
+            return true;
+        }
+
+        /**
+         * Returns the value of this member of <var>obj</var> as a <code>String</code>.
+         */
+        abstract String getString(Object obj) throws IllegalAccessException;
     }
 
     @Override
@@ -147,6 +176,11 @@ class HDF5CompoundMemberByteifyerStringFactory implements IHDF5CompoundMemberByt
         }
     }
 
+    private static String asString(Object o)
+    {
+        return (o.getClass() == char[].class) ? new String((char[]) o) : o.toString();
+    }
+
     private static String refToStr(byte[] byteArr, int offset)
     {
         final long reference = NativeData.byteToLong(byteArr, ByteOrder.NATIVE, offset, 1)[0];
@@ -188,8 +222,7 @@ class HDF5CompoundMemberByteifyerStringFactory implements IHDF5CompoundMemberByt
                 }
 
                 @Override
-                public byte[] byteify(int compoundDataTypeId, Object obj)
-                        throws IllegalAccessException
+                String getString(Object obj) throws IllegalAccessException
                 {
                     Object o = field.get(obj);
                     if (o == null)
@@ -197,7 +230,14 @@ class HDF5CompoundMemberByteifyerStringFactory implements IHDF5CompoundMemberByt
                         throw new NullPointerException("Field '" + field.getName() + "' is null");
 
                     }
-                    final String s = isCharArray ? new String((char[]) o) : o.toString();
+                    return isCharArray ? new String((char[]) o) : o.toString();
+                }
+
+                @Override
+                public byte[] byteify(int compoundDataTypeId, Object obj)
+                        throws IllegalAccessException
+                {
+                    final String s = getString(obj);
                     if (isVariableLengthType)
                     {
                         final byte[] result = new byte[HDFNativeData.getMachineWordSize()];
@@ -241,19 +281,17 @@ class HDF5CompoundMemberByteifyerStringFactory implements IHDF5CompoundMemberByt
                     return stringOrRefDataTypeId;
                 }
 
+                @Override
+                String getString(Object obj) throws IllegalAccessException
+                {
+                    return asString(getMap(obj, memberName));
+                }
+
                 @Override
                 public byte[] byteify(int compoundDataTypeId, Object obj)
                         throws IllegalAccessException
                 {
-                    final Object o = getMap(obj, memberName);
-                    final String s;
-                    if (o.getClass() == char[].class)
-                    {
-                        s = new String((char[]) o);
-                    } else
-                    {
-                        s = o.toString();
-                    }
+                    final String s = getString(obj);
                     if (isVariableLengthType)
                     {
                         final byte[] result = new byte[HDFNativeData.getMachineWordSize()];
@@ -303,19 +341,17 @@ class HDF5CompoundMemberByteifyerStringFactory implements IHDF5CompoundMemberByt
                     return stringOrRefDataTypeId;
                 }
 
+                @Override
+                String getString(Object obj) throws IllegalAccessException
+                {
+                    return asString(getList(obj, index));
+                }
+
                 @Override
                 public byte[] byteify(int compoundDataTypeId, Object obj)
                         throws IllegalAccessException
                 {
-                    final Object o = getList(obj, index);
-                    final String s;
-                    if (o.getClass() == char[].class)
-                    {
-                        s = new String((char[]) o);
-                    } else
-                    {
-                        s = o.toString();
-                    }
+                    final String s = getString(obj);
                     if (isVariableLengthType)
                     {
                         final byte[] result = new byte[HDFNativeData.getMachineWordSize()];
@@ -365,19 +401,17 @@ class HDF5CompoundMemberByteifyerStringFactory implements IHDF5CompoundMemberByt
                     return stringOrRefDataTypeId;
                 }
 
+                @Override
+                String getString(Object obj) throws IllegalAccessException
+                {
+                    return asString(getArray(obj, index));
+                }
+
                 @Override
                 public byte[] byteify(int compoundDataTypeId, Object obj)
                         throws IllegalAccessException
                 {
-                    final Object o = getArray(obj, index);
-                    final String s;
-                    if (o.getClass() == char[].class)
-                    {
-                        s = new String((char[]) o);
-                    } else
-                    {
-                        s = o.toString();
-                    }
+                    final String s = getString(obj);
                     if (isVariableLengthType)
                     {
                         final byte[] result = new byte[HDFNativeData.getMachineWordSize()];
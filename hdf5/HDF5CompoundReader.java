@@ -16,9 +16,14 @@
 
 package ch.systemsx.cisd.hdf5;
 
+import static ch.systemsx.cisd.hdf5.hdf5lib.H5T.H5Tinsert;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_ARRAY;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_COMPOUND;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_FLOAT;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_INTEGER;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_STRING;
 
+import java.util.Arrays;
 import java.util.Iterator;
 
 import ncsa.hdf.hdf5lib.exceptions.HDF5JavaException;
@@ -29,6 +34,7 @@ import ch.systemsx.cisd.hdf5.HDF5BaseReader.DataSpaceParameters;
 import ch.systemsx.cisd.hdf5.HDF5DataTypeInformation.DataTypeInfoOptions;
 import ch.systemsx.cisd.hdf5.cleanup.ICallableWithCleanUp;
 import ch.systemsx.cisd.hdf5.cleanup.ICleanUpRegistry;
+import ch.systemsx.cisd.hdf5.hdf5lib.HDFNativeData;
 
 /**
  * The implementation of {@link IHDF5CompoundReader}.
@@ -419,6 +425,397 @@ class HDF5CompoundReader extends HDF5CompoundInformationRetriever implements IHD
         return primGetCompoundArrayNaturalBlocks(objectPath, dataSetCompoundType, params, null);
     }
 
+    @Override
+    public HDF5CompoundColumns readColumns(final String objectPath, final String... memberNames)
+            throws HDF5JavaException
+    {
+        baseReader.checkOpen();
+        return primReadColumns(objectPath, -1, -1, memberNames);
+    }
+
+    @Override
+    public HDF5CompoundColumns readColumnsBlock(final String objectPath, final int blockSize,
+            final long blockNumber, final String... memberNames) throws HDF5JavaException
+    {
+        baseReader.checkOpen();
+        return primReadColumns(objectPath, blockSize, blockSize * blockNumber, memberNames);
+    }
+
+    @Override
+    public HDF5CompoundColumns readColumnsBlockWithOffset(final String objectPath,
+            final int blockSize, final long offset, final String... memberNames)
+            throws HDF5JavaException
+    {
+        baseReader.checkOpen();
+        return primReadColumns(objectPath, blockSize, offset, memberNames);
+    }
+
+    @Override
+    public Iterable<HDF5DataBlock<HDF5CompoundColumns>> getColumnBlocks(final String objectPath,
+            final String... memberNames) throws HDF5JavaException
+    {
+        baseReader.checkOpen();
+        final HDF5NaturalBlock1DParameters params =
+                new HDF5NaturalBlock1DParameters(baseReader.getDataSetInformation(objectPath));
+
+        return new Iterable<HDF5DataBlock<HDF5CompoundColumns>>()
+            {
+                @Override
+                public Iterator<HDF5DataBlock<HDF5CompoundColumns>> iterator()
+                {
+                    return new Iterator<HDF5DataBlock<HDF5CompoundColumns>>()
+                        {
+                            final HDF5NaturalBlock1DParameters.HDF5NaturalBlock1DIndex index =
+                                    params.getNaturalBlockIndex();
+
+                            @Override
+                            public boolean hasNext()
+                            {
+                                return index.hasNext();
+                            }
+
+                            @Override
+                            public HDF5DataBlock<HDF5CompoundColumns> next()
+                            {
+                                final long offset = index.computeOffsetAndSizeGetOffset();
+                                final HDF5CompoundColumns block =
+                                        readColumnsBlockWithOffset(objectPath,
+                                                index.getBlockSize(), offset, memberNames);
+                                return new HDF5DataBlock<HDF5CompoundColumns>(block,
+                                        index.getAndIncIndex(), offset);
+                            }
+
+                            @Override
+                            public void remove()
+                            {
+                                throw new UnsupportedOperationException();
+                            }
+                        };
+                }
+            };
+    }
+
+    @Override
+    public HDF5CompoundCursor getCursor(final String objectPath, final HDF5CompoundType<?> type)
+            throws HDF5JavaException
+    {
+        return getCursor(objectPath, type, HDF5CompoundCursor.DEFAULT_BLOCK_SIZE);
+    }
+
+    @Override
+    public HDF5CompoundCursor getCursor(final String objectPath, final HDF5CompoundType<?> type,
+            final int blockSize) throws HDF5JavaException
+    {
+        baseReader.checkOpen();
+        type.check(baseReader.fileId);
+        final ICallableWithCleanUp<Long> sizeRunnable = new ICallableWithCleanUp<Long>()
+            {
+                @Override
+                public Long call(final ICleanUpRegistry registry)
+                {
+                    final int dataSetId =
+                            baseReader.h5.openDataSet(baseReader.fileId, objectPath, registry);
+                    final int storageDataTypeId =
+                            baseReader.h5.getDataTypeForDataSet(dataSetId, registry);
+                    checkCompoundType(storageDataTypeId, objectPath, type);
+                    final long[] dimensions =
+                            baseReader.h5.getDataDimensions(dataSetId, registry);
+                    if (dimensions.length != 1)
+                    {
+                        throw new HDF5JavaException("Data set '" + objectPath
+                                + "' is expected to be of rank 1 (rank=" + dimensions.length
+                                + ")");
+                    }
+                    return dimensions[0];
+                }
+            };
+        final long size = baseReader.runner.call(sizeRunnable);
+        return new HDF5CompoundCursor(baseReader, objectPath, type, size, blockSize);
+    }
+
+    @Override
+    public HDF5CompoundCursor getCursor(final String objectPath) throws HDF5JavaException
+    {
+        baseReader.checkOpen();
+        final HDF5CompoundType<HDF5CompoundDataMap> dataSetCompoundType =
+                getDataSetType(objectPath, HDF5CompoundDataMap.class);
+        return getCursor(objectPath, dataSetCompoundType);
+    }
+
+    /**
+     * A member of a compound data set that is read as a column.
+     */
+    private static final class ColumnMember
+    {
+        final String name;
+
+        final int storageTypeId;
+
+        final int memoryTypeId;
+
+        final int memberClass;
+
+        final int size;
+
+        /** The offset of the member in the packed record read. */
+        final int offset;
+
+        ColumnMember(String name, int storageTypeId, int memoryTypeId, int memberClass, int size,
+                int offset)
+        {
+            this.name = name;
+            this.storageTypeId = storageTypeId;
+            this.memoryTypeId = memoryTypeId;
+            this.memberClass = memberClass;
+            this.size = size;
+            this.offset = offset;
+        }
+    }
+
+    /**
+     * Reads the members <var>memberNames</var> of a compound data set with one read by means of a
+     * memory compound type that packs only these members. The HDF5 library picks the members out of
+     * each record on its own while converting, the packed records are then split into columns.
+     */
+    private HDF5CompoundColumns primReadColumns(final String objectPath, final int blockSize,
+            final long offset, final String[] memberNames) throws HDF5JavaException
+    {
+        final ICallableWithCleanUp<HDF5CompoundColumns> readRunnable =
+                new ICallableWithCleanUp<HDF5CompoundColumns>()
+                    {
+                        @Override
+                        public HDF5CompoundColumns call(final ICleanUpRegistry registry)
+                        {
+                            final int dataSetId =
+                                    baseReader.h5.openDataSet(baseReader.fileId, objectPath,
+                                            registry);
+                            final int storageDataTypeId =
+                                    baseReader.h5.getDataTypeForDataSet(dataSetId, registry);
+                            if (baseReader.h5.getClassType(storageDataTypeId) != H5T_COMPOUND)
+                            {
+                                throw new HDF5JavaException("Data set '" + objectPath
+                                        + "' is no compound.");
+                            }
+                            final DataSpaceParameters spaceParams =
+                                    baseReader.getSpaceParameters(dataSetId, offset, blockSize,
+                                            registry);
+                            final ColumnMember[] members = new ColumnMember[memberNames.length];
+                            int recordSize = 0;
+                            for (int i = 0; i < memberNames.length; ++i)
+                            {
+                                members[i] = tryFindColumnMember(members, i, memberNames[i]);
+                                if (members[i] == null)
+                                {
+                                    members[i] =
+                                            getColumnMember(storageDataTypeId, objectPath,
+                                                    memberNames[i], recordSize, registry);
+                                    recordSize += members[i].size;
+                                }
+                            }
+                            final int memoryTypeId =
+                                    baseReader.h5.createDataTypeCompound(recordSize, registry);
+                            for (int i = 0; i < members.length; ++i)
+                            {
+                                // Duplicates share the member of their first occurrence.
+                                if (tryFindColumnMember(members, i, memberNames[i]) == null)
+                                {
+                                    H5Tinsert(memoryTypeId, members[i].name, members[i].offset,
+                                            members[i].memoryTypeId);
+                                }
+                            }
+                            final int len = spaceParams.blockSize;
+                            final byte[] byteArr = new byte[len * recordSize];
+                            baseReader.h5.readDataSet(dataSetId, memoryTypeId,
+                                    spaceParams.memorySpaceId, spaceParams.dataSpaceId, byteArr);
+                            final Object[] columns = new Object[members.length];
+                            for (int i = 0; i < members.length; ++i)
+                            {
+                                columns[i] = splitColumn(byteArr, recordSize, len, members[i]);
+                            }
+                            freeVLStrings(byteArr, recordSize, members);
+                            return new HDF5CompoundColumns(memberNames.clone(), columns,
+                                    spaceParams.blockSize);
+                        }
+                    };
+        return baseReader.runner.call(readRunnable);
+    }
+
+    /**
+     * Returns the member of <var>members</var> before <var>index</var> that is called
+     * <var>memberName</var>, or <code>null</code>, if the member has not been requested before.
+     */
+    private static ColumnMember tryFindColumnMember(ColumnMember[] members, int index,
+            String memberName)
+    {
+        for (int i = 0; i < index; ++i)
+        {
+            if (members[i].name.equals(memberName))
+            {
+                return members[i];
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Returns the member <var>memberName</var> of <var>storageDataTypeId</var>, placed at
+     * <var>offset</var> of the packed record.
+     *
+     * @throws HDF5JavaException If there is no such member or it can't be read as a column.
+     */
+    private ColumnMember getColumnMember(final int storageDataTypeId, final String objectPath,
+            final String memberName, final int offset, final ICleanUpRegistry registry)
+            throws HDF5JavaException
+    {
+        final int memberIndex = baseReader.h5.getIndexForMemberName(storageDataTypeId, memberName);
+        if (memberIndex < 0)
+        {
+            throw new HDF5JavaException("Compound data set '" + objectPath
+                    + "' has no member '" + memberName + "'.");
+        }
+        final int memberStorageTypeId =
+                baseReader.h5.getDataTypeForIndex(storageDataTypeId, memberIndex, registry);
+        final int memberClass = baseReader.h5.getClassType(memberStorageTypeId);
+        final int memberMemoryTypeId =
+                (memberClass == H5T_STRING) ? memberStorageTypeId : baseReader.h5
+                        .getNativeDataType(memberStorageTypeId, registry);
+        final int memberSize = baseReader.h5.getDataTypeSize(memberMemoryTypeId);
+        final boolean supported;
+        if (memberClass == H5T_INTEGER)
+        {
+            supported = (memberSize == 1 || memberSize == 2 || memberSize == 4 || memberSize == 8);
+        } else if (memberClass == H5T_FLOAT)
+        {
+            supported = (memberSize == 4 || memberSize == 8);
+        } else
+        {
+            supported = (memberClass == H5T_STRING);
+        }
+        if (supported == false)
+        {
+            throw new HDF5JavaException("Member '" + memberName + "' of compound data set '"
+                    + objectPath + "' is of a type that cannot be read as a column (class "
+                    + memberClass + ", size " + memberSize + ").");
+        }
+        return new ColumnMember(memberName, memberStorageTypeId, memberMemoryTypeId, memberClass,
+                memberSize, offset);
+    }
+
+    /**
+     * Copies <var>member</var> out of the <var>len</var> packed records of <var>recordSize</var>
+     * bytes in <var>byteArr</var> into a new column.
+     */
+    private Object splitColumn(final byte[] byteArr, final int recordSize, final int len,
+            final ColumnMember member)
+    {
+        if (member.memberClass == H5T_INTEGER)
+        {
+            switch (member.size)
+            {
+                case 1:
+                {
+                    final byte[] column = new byte[len];
+                    for (int i = 0, ofs = member.offset; i < len; ++i, ofs += recordSize)
+                    {
+                        column[i] = byteArr[ofs];
+                    }
+                    return column;
+                }
+                case 2:
+                {
+                    final short[] column = new short[len];
+                    for (int i = 0, ofs = member.offset; i < len; ++i, ofs += recordSize)
+                    {
+                        column[i] = HDFNativeData.byteToShort(byteArr, ofs);
+                    }
+                    return column;
+                }
+                case 4:
+                {
+                    final int[] column = new int[len];
+                    for (int i = 0, ofs = member.offset; i < len; ++i, ofs += recordSize)
+                    {
+                        column[i] = HDFNativeData.byteToInt(byteArr, ofs);
+                    }
+                    return column;
+                }
+                default:
+                {
+                    final long[] column = new long[len];
+                    for (int i = 0, ofs = member.offset; i < len; ++i, ofs += recordSize)
+                    {
+                        column[i] = HDFNativeData.byteToLong(byteArr, ofs);
+                    }
+                    return column;
+                }
+            }
+        } else if (member.memberClass == H5T_FLOAT)
+        {
+            if (member.size == 4)
+            {
+                final float[] column = new float[len];
+                for (int i = 0, ofs = member.offset; i < len; ++i, ofs += recordSize)
+                {
+                    column[i] = HDFNativeData.byteToFloat(byteArr, ofs);
+                }
+                return column;
+            } else
+            {
+                final double[] column = new double[len];
+                for (int i = 0, ofs = member.offset; i < len; ++i, ofs += recordSize)
+                {
+                    column[i] = HDFNativeData.byteToDouble(byteArr, ofs);
+                }
+                return column;
+            }
+        } else
+        {
+            final String[] column = new String[len];
+            if (baseReader.h5.isVariableLengthString(member.storageTypeId))
+            {
+                for (int i = 0, ofs = member.offset; i < len; ++i, ofs += recordSize)
+                {
+                    column[i] = HDFNativeData.createVLStrFromCompound(byteArr, ofs);
+                }
+            } else
+            {
+                final CharacterEncoding encoding =
+                        baseReader.h5.getCharacterEncoding(member.storageTypeId);
+                for (int i = 0, ofs = member.offset; i < len; ++i, ofs += recordSize)
+                {
+                    column[i] =
+                            StringUtils.fromBytes0Term(byteArr, ofs, ofs + member.size, encoding);
+                }
+            }
+            return column;
+        }
+    }
+
+    /**
+     * Frees the variable-length strings of <var>members</var> in the packed records
+     * <var>byteArr</var>.
+     */
+    private void freeVLStrings(final byte[] byteArr, final int recordSize,
+            final ColumnMember[] members)
+    {
+        int count = 0;
+        final int[] vlOffsets = new int[members.length];
+        for (int i = 0; i < members.length; ++i)
+        {
+            final ColumnMember member = members[i];
+            if (member.memberClass == H5T_STRING
+                    && tryFindColumnMember(members, i, member.name) == null
+                    && baseReader.h5.isVariableLengthString(member.storageTypeId))
+            {
+                vlOffsets[count++] = member.offset;
+            }
+        }
+        if (count > 0)
+        {
+            HDFNativeData.freeCompoundVLStr(byteArr, recordSize, Arrays.copyOf(vlOffsets, count));
+        }
+    }
+
     private <T> T primReadCompound(final String objectPath, final int blockSize, final long offset,
             final HDF5CompoundType<T> type, final IByteArrayInspector inspectorOrNull)
             throws HDF5JavaException
@@ -470,12 +867,9 @@ class HDF5CompoundReader extends HDF5CompoundInformationRetriever implements IHD
                     checkCompoundType(storageDataTypeId, objectPath, type);
                     final DataSpaceParameters spaceParams =
                             baseReader.getSpaceParameters(dataSetId, offset, blockSize, registry);
-                    final int nativeDataTypeId = type.getNativeTypeId();
                     final byte[] byteArr =
-                            new byte[spaceParams.blockSize
-                                    * type.getObjectByteifyer().getRecordSizeInMemory()];
-                    baseReader.h5.readDataSet(dataSetId, nativeDataTypeId,
-                            spaceParams.memorySpaceId, spaceParams.dataSpaceId, byteArr);
+                            readRecords(dataSetId, storageDataTypeId, objectPath, type,
+                                    spaceParams, registry);
                     if (inspectorOrNull != null)
                     {
                         inspectorOrNull.inspect(byteArr);
@@ -489,6 +883,74 @@ class HDF5CompoundReader extends HDF5CompoundInformationRetriever implements IHD
         return baseReader.runner.call(readRunnable);
     }
 
+    /**
+     * Reads the records selected by <var>spaceParams</var> in the memory layout of
+     * <var>type</var>, converting them in Java if the reader is configured to do so and there is a
+     * usable conversion plan for the data set.
+     */
+    private byte[] readRecords(final int dataSetId, final int storageDataTypeId,
+            final String objectPath, final HDF5CompoundType<?> type,
+            final DataSpaceParameters spaceParams, final ICleanUpRegistry registry)
+    {
+        final HDF5CompoundConversionPlan planOrNull =
+                tryAcquireConversionPlan(storageDataTypeId, objectPath, type, registry);
+        if (planOrNull == null)
+        {
+            final byte[] byteArr =
+                    new byte[spaceParams.blockSize
+                            * type.getObjectByteifyer().getRecordSizeInMemory()];
+            baseReader.h5.readDataSet(dataSetId, type.getNativeTypeId(),
+                    spaceParams.memorySpaceId, spaceParams.dataSpaceId, byteArr);
+            return byteArr;
+        }
+        try
+        {
+            final byte[] fileRecords =
+                    new byte[spaceParams.blockSize * planOrNull.getFileRecordSize()];
+            baseReader.h5.readDataSet(dataSetId, planOrNull.getFileNativeDataTypeId(),
+                    spaceParams.memorySpaceId, spaceParams.dataSpaceId, fileRecords);
+            return planOrNull.convert(fileRecords, spaceParams.blockSize);
+        } finally
+        {
+            planOrNull.release();
+        }
+    }
+
+    /**
+     * Returns the usable conversion plan for reading <var>objectPath</var> with <var>type</var>,
+     * acquired for the caller, or <code>null</code>, if the library conversion needs to be used.
+     */
+    private HDF5CompoundConversionPlan tryAcquireConversionPlan(final int storageDataTypeId,
+            final String objectPath, final HDF5CompoundType<?> type,
+            final ICleanUpRegistry registry)
+    {
+        if (baseReader.convertCompoundsInJava == false)
+        {
+            return null;
+        }
+        HDF5CompoundConversionPlan plan =
+                baseReader.compoundTypeCache.tryGetPlan(objectPath, type);
+        if (plan != null && plan.tryAcquire())
+        {
+            // The data set may have been re-created with a different type since.
+            if (plan.appliesTo(baseReader.h5, storageDataTypeId))
+            {
+                if (plan.isUsable())
+                {
+                    return plan;
+                }
+                plan.release();
+                return null;
+            }
+            plan.release();
+        }
+        plan =
+                baseReader.compoundTypeCache.putPlan(objectPath, type,
+                        HDF5CompoundConversionPlan.create(baseReader.h5, storageDataTypeId,
+                                type, registry));
+        return (plan.isUsable() && plan.tryAcquire()) ? plan : null;
+    }
+
     private void checkCompoundType(final int dataTypeId, final String path,
             final HDF5CompoundType<?> type) throws HDF5JavaException
     {
@@ -584,12 +1046,9 @@ class HDF5CompoundReader extends HDF5CompoundInformationRetriever implements IHD
                             final DataSpaceParameters spaceParams =
                                     baseReader.getSpaceParameters(dataSetId, offsetOrNull,
                                             dimensionsOrNull, registry);
-                            final int nativeDataTypeId = type.getNativeTypeId();
                             final byte[] byteArr =
-                                    new byte[spaceParams.blockSize
-                                            * type.getObjectByteifyer().getRecordSizeInMemory()];
-                            baseReader.h5.readDataSet(dataSetId, nativeDataTypeId,
-                                    spaceParams.memorySpaceId, spaceParams.dataSpaceId, byteArr);
+                                    readRecords(dataSetId, storageDataTypeId, objectPath, type,
+                                            spaceParams, registry);
                             if (inspectorOrNull != null)
                             {
                                 inspectorOrNull.inspect(byteArr);
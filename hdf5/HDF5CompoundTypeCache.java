@@ -0,0 +1,288 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5;
+
+import java.util.HashMap;
+import java.util.LinkedHashMap;
+import java.util.Map;
+
+import org.apache.commons.lang.ObjectUtils;
+
+import ch.systemsx.cisd.hdf5.HDF5CompoundMappingHints.EnumReturnType;
+import ch.systemsx.cisd.hdf5.HDF5DataTypeInformation.DataTypeInfoOptions;
+
+/**
+ * A bounded LRU cache of the compound types of one HDF5 file that have been created from a Java
+ * class by inferring the member mapping.
+ * <p>
+ * Inferring a compound type means reflection over the class, building the member mappings and
+ * creating new HDF5 data types, which dominates the cost of reading small compound data sets with
+ * <code>readArray(String, Class)</code>. The key captures everything the mapping depends on: the
+ * class, a snapshot of the mapping hints, the committed data type path (or, for anonymous types,
+ * the type name or data set path) and the type info options. The types themselves are released
+ * with the file, so the cache only needs to be cleared when the file's links change.
+ * <p>
+ * The cache also keeps the {@link HDF5CompoundConversionPlan}s computed for data sets, keyed by
+ * data set path and memory type. Plans own data types, so they are closed when they are evicted,
+ * replaced or cleared.
+ *
+ * @author Bernd Rinn
+ */
+final class HDF5CompoundTypeCache
+{
+
+    /** The default maximal number of compound types kept. */
+    static final int DEFAULT_CAPACITY = 256;
+
+    /**
+     * The way a cached compound type has been obtained.
+     */
+    enum Origin
+    {
+        /** Inferred from a class, not committed to the file. */
+        INFERRED,
+
+        /** Inferred from a class and committed to the file. */
+        INFERRED_COMMITTED,
+
+        /** Mapped from a committed data type, given its path. */
+        COMMITTED,
+
+        /** Mapped from the anonymous data type of a data set, given the data set path. */
+        DATA_SET
+    }
+
+    /**
+     * The key of a cached compound type.
+     */
+    static final class Key
+    {
+        private final Origin origin;
+
+        private final String nameOrPath;
+
+        private final Class<?> pojoClass;
+
+        private final EnumReturnType enumReturnTypeOrNull;
+
+        private final boolean useVariableLengthStrings;
+
+        private final Map<String, HDF5EnumerationType> enumTypeMappingOrNull;
+
+        private final DataTypeInfoOptions dataTypeInfoOptionsOrNull;
+
+        private final boolean requireTypesToBeEqual;
+
+        Key(Origin origin, String nameOrPath, Class<?> pojoClass,
+                HDF5CompoundMappingHints hintsOrNull,
+                DataTypeInfoOptions dataTypeInfoOptionsOrNull, boolean requireTypesToBeEqual)
+        {
+            this.origin = origin;
+            this.nameOrPath = nameOrPath;
+            this.pojoClass = pojoClass;
+            // Hints are mutable, so keep a snapshot of their content rather than the object.
+            this.enumReturnTypeOrNull =
+                    (hintsOrNull == null) ? null : hintsOrNull.getEnumReturnType();
+            this.useVariableLengthStrings =
+                    HDF5CompoundMappingHints.isUseVariableLengthStrings(hintsOrNull);
+            final Map<String, HDF5EnumerationType> enumTypeMappingOrNull =
+                    (hintsOrNull == null) ? null : hintsOrNull.tryGetEnumTypeMapping();
+            this.enumTypeMappingOrNull =
+                    (enumTypeMappingOrNull == null) ? null
+                            : new HashMap<String, HDF5EnumerationType>(enumTypeMappingOrNull);
+            this.dataTypeInfoOptionsOrNull = dataTypeInfoOptionsOrNull;
+            this.requireTypesToBeEqual = requireTypesToBeEqual;
+        }
+
+        Origin getOrigin()
+        {
+            return origin;
+        }
+
+        @Override
+        public int hashCode()
+        {
+            int result = 17;
+            result = 31 * result + origin.hashCode();
+            result = 31 * result + ObjectUtils.hashCode(nameOrPath);
+            result = 31 * result + pojoClass.hashCode();
+            result = 31 * result + ObjectUtils.hashCode(enumReturnTypeOrNull);
+            result = 31 * result + (useVariableLengthStrings ? 1 : 0);
+            result = 31 * result + ObjectUtils.hashCode(enumTypeMappingOrNull);
+            result = 31 * result + ObjectUtils.hashCode(dataTypeInfoOptionsOrNull);
+            result = 31 * result + (requireTypesToBeEqual ? 1 : 0);
+            return result;
+        }
+
+        @Override
+        public boolean equals(Object obj)
+        {
+            if (this == obj)
+            {
+                return true;
+            }
+            if (obj == null || getClass() != obj.getClass())
+            {
+                return false;
+            }
+            final Key that = (Key) obj;
+            return origin == that.origin && ObjectUtils.equals(nameOrPath, that.nameOrPath)
+                    && pojoClass == that.pojoClass
+                    && enumReturnTypeOrNull == that.enumReturnTypeOrNull
+                    && useVariableLengthStrings == that.useVariableLengthStrings
+                    && ObjectUtils.equals(enumTypeMappingOrNull, that.enumTypeMappingOrNull)
+                    && ObjectUtils.equals(dataTypeInfoOptionsOrNull,
+                            that.dataTypeInfoOptionsOrNull)
+                    && requireTypesToBeEqual == that.requireTypesToBeEqual;
+        }
+    }
+
+    /**
+     * The key of a cached conversion plan.
+     */
+    private static final class PlanKey
+    {
+        private final String dataSetPath;
+
+        private final HDF5CompoundType<?> type;
+
+        PlanKey(String dataSetPath, HDF5CompoundType<?> type)
+        {
+            this.dataSetPath = dataSetPath;
+            this.type = type;
+        }
+
+        @Override
+        public int hashCode()
+        {
+            return 31 * dataSetPath.hashCode() + System.identityHashCode(type);
+        }
+
+        @Override
+        public boolean equals(Object obj)
+        {
+            if (this == obj)
+            {
+                return true;
+            }
+            if (obj == null || getClass() != obj.getClass())
+            {
+                return false;
+            }
+            final PlanKey that = (PlanKey) obj;
+            return dataSetPath.equals(that.dataSetPath) && type == that.type;
+        }
+    }
+
+    private final Map<Key, HDF5CompoundType<?>> types;
+
+    private final Map<PlanKey, HDF5CompoundConversionPlan> plans;
+
+    HDF5CompoundTypeCache()
+    {
+        this(DEFAULT_CAPACITY);
+    }
+
+    HDF5CompoundTypeCache(final int capacity)
+    {
+        this.types = new LinkedHashMap<Key, HDF5CompoundType<?>>(16, 0.75f, true)
+            {
+                private static final long serialVersionUID = 1L;
+
+                @Override
+                protected boolean removeEldestEntry(Map.Entry<Key, HDF5CompoundType<?>> eldest)
+                {
+                    return size() > capacity;
+                }
+            };
+        this.plans = new LinkedHashMap<PlanKey, HDF5CompoundConversionPlan>(16, 0.75f, true)
+            {
+                private static final long serialVersionUID = 1L;
+
+                @Override
+                protected boolean removeEldestEntry(
+                        Map.Entry<PlanKey, HDF5CompoundConversionPlan> eldest)
+                {
+                    if (size() > capacity)
+                    {
+                        eldest.getValue().close();
+                        return true;
+                    }
+                    return false;
+                }
+            };
+    }
+
+    /**
+     * Returns the compound type for <var>key</var>, or <code>null</code>, if it is not in the
+     * cache.
+     */
+    @SuppressWarnings("unchecked")
+    synchronized <T> HDF5CompoundType<T> tryGet(Key key)
+    {
+        return (HDF5CompoundType<T>) types.get(key);
+    }
+
+    /**
+     * Puts <var>type</var> into the cache, using <var>key</var>, and returns it.
+     */
+    synchronized <T> HDF5CompoundType<T> put(Key key, HDF5CompoundType<T> type)
+    {
+        types.put(key, type);
+        return type;
+    }
+
+    /**
+     * Returns the conversion plan for reading data set <var>dataSetPath</var> with
+     * <var>type</var>, or <code>null</code>, if it is not in the cache.
+     */
+    synchronized HDF5CompoundConversionPlan tryGetPlan(String dataSetPath, HDF5CompoundType<?> type)
+    {
+        return plans.get(new PlanKey(dataSetPath, type));
+    }
+
+    /**
+     * Puts <var>plan</var> for reading data set <var>dataSetPath</var> with <var>type</var> into
+     * the cache and returns it. A plan that is replaced is closed.
+     */
+    synchronized HDF5CompoundConversionPlan putPlan(String dataSetPath, HDF5CompoundType<?> type,
+            HDF5CompoundConversionPlan plan)
+    {
+        final HDF5CompoundConversionPlan replacedOrNull =
+                plans.put(new PlanKey(dataSetPath, type), plan);
+        if (replacedOrNull != null && replacedOrNull != plan)
+        {
+            replacedOrNull.close();
+        }
+        return plan;
+    }
+
+    /**
+     * Removes all types and plans from the cache. Needs to be called whenever links of the file are
+     * deleted or moved and when the file is closed.
+     */
+    synchronized void clear()
+    {
+        types.clear();
+        for (HDF5CompoundConversionPlan plan : plans.values())
+        {
+            plan.close();
+        }
+        plans.clear();
+    }
+
+}
@@ -23,8 +23,11 @@ import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5S_ALL;
 import java.util.List;
 import java.util.Map;
 
+import ncsa.hdf.hdf5lib.exceptions.HDF5JavaException;
+
 import ch.systemsx.cisd.base.mdarray.MDAbstractArray;
 import ch.systemsx.cisd.base.mdarray.MDArray;
+import ch.systemsx.cisd.hdf5.HDF5CompoundTypeCache.Origin;
 import ch.systemsx.cisd.hdf5.HDF5DataTypeInformation.DataTypeInfoOptions;
 import ch.systemsx.cisd.hdf5.cleanup.ICallableWithCleanUp;
 import ch.systemsx.cisd.hdf5.cleanup.ICleanUpRegistry;
@@ -93,17 +96,29 @@ class HDF5CompoundWriter extends HDF5CompoundReader implements IHDF5CompoundWrit
         return getType(null, true, pojoClass, true, members);
     }
 
+    @Override
+    boolean isCommittingInferredTypes()
+    {
+        return true;
+    }
+
     @Override
     public <T> HDF5CompoundType<T> getInferredAnonType(Class<T> pojoClass,
             HDF5CompoundMappingHints hints)
     {
-        return getType(
-                null,
-                true,
-                pojoClass,
-                true,
-                addEnumTypes(HDF5CompoundMemberMapping.addHints(
-                        HDF5CompoundMemberMapping.inferMapping(pojoClass), hints)));
+        baseWriter.checkOpen();
+        final HDF5CompoundTypeCache.Key key =
+                new HDF5CompoundTypeCache.Key(Origin.INFERRED, null, pojoClass, hints, null, true);
+        final HDF5CompoundType<T> cachedTypeOrNull = baseWriter.compoundTypeCache.tryGet(key);
+        if (cachedTypeOrNull != null)
+        {
+            return cachedTypeOrNull;
+        }
+        return baseWriter.compoundTypeCache.put(
+                key,
+                getType(null, true, pojoClass, true,
+                        addEnumTypes(HDF5CompoundMemberMapping.addHints(
+                                HDF5CompoundMemberMapping.inferMapping(pojoClass), hints))));
     }
 
     @Override
@@ -480,17 +495,19 @@ class HDF5CompoundWriter extends HDF5CompoundReader implements IHDF5CompoundWrit
                                     new long[]
                                         { data.length }, type.getObjectByteifyer()
                                             .getRecordSizeOnDisk(), features, registry);
+                    final HDF5VLStringArena arenaOrNull =
+                            type.getObjectByteifyer().tryCreateVLStringArena();
                     @SuppressWarnings("unchecked")
                     final byte[] byteArray =
                             ((HDF5CompoundType<T>) type).getObjectByteifyer().byteify(
-                                    type.getStorageTypeId(), data);
+                                    type.getStorageTypeId(), data, arenaOrNull);
                     if (inspectorOrNull != null)
                     {
                         inspectorOrNull.inspect(byteArray);
                     }
                     H5Dwrite(dataSetId, type.getNativeTypeId(), H5S_ALL, H5S_ALL, H5P_DEFAULT,
                             byteArray);
-                    baseWriter.h5.reclaimCompoundVL(type, byteArray);
+                    baseWriter.h5.reclaimCompoundVL(type, byteArray, arenaOrNull);
                     return null; // Nothing to return.
                 }
             };
@@ -550,15 +567,18 @@ class HDF5CompoundWriter extends HDF5CompoundReader implements IHDF5CompoundWrit
                     baseWriter.h5.setHyperslabBlock(dataSpaceId, offset, dimensions);
                     final int memorySpaceId =
                             baseWriter.h5.createSimpleDataSpace(dimensions, registry);
+                    final HDF5VLStringArena arenaOrNull =
+                            type.getObjectByteifyer().tryCreateVLStringArena();
                     final byte[] byteArray =
-                            type.getObjectByteifyer().byteify(type.getStorageTypeId(), data);
+                            type.getObjectByteifyer().byteify(type.getStorageTypeId(), data,
+                                    arenaOrNull);
                     if (inspectorOrNull != null)
                     {
                         inspectorOrNull.inspect(byteArray);
                     }
                     H5Dwrite(dataSetId, type.getNativeTypeId(), memorySpaceId, dataSpaceId,
                             H5P_DEFAULT, byteArray);
-                    baseWriter.h5.reclaimCompoundVL(type, byteArray);
+                    baseWriter.h5.reclaimCompoundVL(type, byteArray, arenaOrNull);
                     return null; // Nothing to return.
                 }
             };
@@ -603,21 +623,74 @@ class HDF5CompoundWriter extends HDF5CompoundReader implements IHDF5CompoundWrit
                     baseWriter.h5.setHyperslabBlock(dataSpaceId, offsetArray, dimensions);
                     final int memorySpaceId =
                             baseWriter.h5.createSimpleDataSpace(dimensions, registry);
+                    final HDF5VLStringArena arenaOrNull =
+                            type.getObjectByteifyer().tryCreateVLStringArena();
                     final byte[] byteArray =
-                            type.getObjectByteifyer().byteify(type.getStorageTypeId(), data);
+                            type.getObjectByteifyer().byteify(type.getStorageTypeId(), data,
+                                    arenaOrNull);
                     if (inspectorOrNull != null)
                     {
                         inspectorOrNull.inspect(byteArray);
                     }
                     H5Dwrite(dataSetId, type.getNativeTypeId(), memorySpaceId, dataSpaceId,
                             H5P_DEFAULT, byteArray);
-                    baseWriter.h5.reclaimCompoundVL(type, byteArray);
+                    baseWriter.h5.reclaimCompoundVL(type, byteArray, arenaOrNull);
                     return null; // Nothing to return.
                 }
             };
         baseWriter.runner.call(writeRunnable);
     }
 
+    @Override
+    public <T> HDF5CompoundAppender<T> getAppender(String objectPath, HDF5CompoundType<T> type)
+            throws HDF5JavaException
+    {
+        return getAppender(objectPath, type, HDF5CompoundAppender.DEFAULT_BATCH_SIZE,
+                HDF5CompoundAppender.DEFAULT_MAX_DELAY_MILLIS);
+    }
+
+    @Override
+    public <T> HDF5CompoundAppender<T> getAppender(String objectPath, HDF5CompoundType<T> type,
+            int batchSize, long maxDelayMillis) throws HDF5JavaException
+    {
+        return getAppender(objectPath, type, HDF5GenericStorageFeatures.GENERIC_NO_COMPRESSION,
+                batchSize, maxDelayMillis);
+    }
+
+    @Override
+    public <T> HDF5CompoundAppender<T> getAppender(final String objectPath,
+            final HDF5CompoundType<T> type, final HDF5GenericStorageFeatures features,
+            final int batchSize, final long maxDelayMillis) throws HDF5JavaException
+    {
+        assert objectPath != null;
+        assert type != null;
+
+        baseWriter.checkOpen();
+        type.check(baseWriter.fileId);
+        final long size;
+        if (baseWriter.h5.exists(baseWriter.fileId, objectPath))
+        {
+            final HDF5DataSetInformation info = baseWriter.getDataSetInformation(objectPath);
+            if (info.getRank() != 1)
+            {
+                throw new HDF5JavaException("Data set '" + objectPath + "' is of rank "
+                        + info.getRank() + ", but rank 1 is required for appending.");
+            }
+            if (info.getStorageLayout() != HDF5StorageLayout.CHUNKED)
+            {
+                throw new HDF5JavaException("Data set '" + objectPath
+                        + "' is not extendable (layout " + info.getStorageLayout() + ").");
+            }
+            size = info.getDimensions()[0];
+        } else
+        {
+            createArray(objectPath, type, 0L, batchSize, features);
+            size = 0L;
+        }
+        return new HDF5CompoundAppender<T>(baseWriter, objectPath, type, size, batchSize,
+                maxDelayMillis);
+    }
+
     @Override
     public <T> void createArray(String objectPath, HDF5CompoundType<T> type, int size)
     {
@@ -736,16 +809,18 @@ class HDF5CompoundWriter extends HDF5CompoundReader implements IHDF5CompoundWrit
                                     MDAbstractArray.toLong(data.dimensions()), type
                                             .getObjectByteifyer().getRecordSizeOnDisk(), features,
                                     registry);
+                    final HDF5VLStringArena arenaOrNull =
+                            type.getObjectByteifyer().tryCreateVLStringArena();
                     final byte[] byteArray =
                             type.getObjectByteifyer().byteify(type.getStorageTypeId(),
-                                    data.getAsFlatArray());
+                                    data.getAsFlatArray(), arenaOrNull);
                     if (inspectorOrNull != null)
                     {
                         inspectorOrNull.inspect(byteArray);
                     }
                     H5Dwrite(dataSetId, type.getNativeTypeId(), H5S_ALL, H5S_ALL, H5P_DEFAULT,
                             byteArray);
-                    baseWriter.h5.reclaimCompoundVL(type, byteArray);
+                    baseWriter.h5.reclaimCompoundVL(type, byteArray, arenaOrNull);
                     return null; // Nothing to return.
                 }
             };
@@ -823,15 +898,18 @@ class HDF5CompoundWriter extends HDF5CompoundReader implements IHDF5CompoundWrit
                     baseWriter.h5.setHyperslabBlock(dataSpaceId, offset, dimensions);
                     final int memorySpaceId =
                             baseWriter.h5.createSimpleDataSpace(dimensions, registry);
+                    final HDF5VLStringArena arenaOrNull =
+                            type.getObjectByteifyer().tryCreateVLStringArena();
                     final byte[] byteArray =
-                            type.getObjectByteifyer().byteify(type.getStorageTypeId(), data);
+                            type.getObjectByteifyer().byteify(type.getStorageTypeId(), data,
+                                    arenaOrNull);
                     if (inspectorOrNull != null)
                     {
                         inspectorOrNull.inspect(byteArray);
                     }
                     H5Dwrite(dataSetId, type.getNativeTypeId(), memorySpaceId, dataSpaceId,
                             H5P_DEFAULT, byteArray);
-                    baseWriter.h5.reclaimCompoundVL(type, byteArray);
+                    baseWriter.h5.reclaimCompoundVL(type, byteArray, arenaOrNull);
                     return null; // Nothing to return.
                 }
             };
@@ -881,16 +959,18 @@ class HDF5CompoundWriter extends HDF5CompoundReader implements IHDF5CompoundWrit
                             baseWriter.h5.createSimpleDataSpace(memoryDimensions, registry);
                     baseWriter.h5.setHyperslabBlock(memorySpaceId,
                             MDAbstractArray.toLong(memoryOffset), longBlockDimensions);
+                    final HDF5VLStringArena arenaOrNull =
+                            type.getObjectByteifyer().tryCreateVLStringArena();
                     final byte[] byteArray =
                             type.getObjectByteifyer().byteify(type.getStorageTypeId(),
-                                    data.getAsFlatArray());
+                                    data.getAsFlatArray(), arenaOrNull);
                     if (inspectorOrNull != null)
                     {
                         inspectorOrNull.inspect(byteArray);
                     }
                     H5Dwrite(dataSetId, type.getNativeTypeId(), memorySpaceId, dataSpaceId,
                             H5P_DEFAULT, byteArray);
-                    baseWriter.h5.reclaimCompoundVL(type, byteArray);
+                    baseWriter.h5.reclaimCompoundVL(type, byteArray, arenaOrNull);
                     return null; // Nothing to return.
                 }
             };
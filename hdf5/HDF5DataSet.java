@@ -26,6 +26,8 @@ import static ch.systemsx.cisd.hdf5.hdf5lib.H5S.H5Sclose;
  */
 public class HDF5DataSet implements AutoCloseable
 {
+    private final HDF5 h5;
+
     private final String datasetPath;
 
     private final HDF5StorageLayout layout;
@@ -38,9 +40,10 @@ public class HDF5DataSet implements AutoCloseable
 
     private int datasetId;
 
-    HDF5DataSet(String datasetPath, int datasetId, int dataspaceId, long[] dimensions,
+    HDF5DataSet(HDF5 h5, String datasetPath, int datasetId, int dataspaceId, long[] dimensions,
             long[] maxDimensions, HDF5StorageLayout layout)
     {
+        this.h5 = h5;
         this.datasetPath = datasetPath;
         this.datasetId = datasetId;
         this.dataspaceId = dataspaceId;
@@ -57,13 +60,23 @@ public class HDF5DataSet implements AutoCloseable
         return datasetPath;
     }
 
+    /**
+     * Returns the id of this data set, after notifying the listeners of the file that it is
+     * accessed.
+     */
     int getDatasetId()
     {
+        h5.fireObjectAccessed(datasetPath);
         return datasetId;
     }
 
+    /**
+     * Returns the id of the data space of this data set, after notifying the listeners of the file
+     * that it is accessed.
+     */
     int getDataspaceId()
     {
+        h5.fireObjectAccessed(datasetPath);
         return dataspaceId;
     }
 
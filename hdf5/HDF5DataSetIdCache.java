@@ -0,0 +1,143 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5;
+
+import static ch.systemsx.cisd.hdf5.hdf5lib.H5D.H5Dclose;
+import static ch.systemsx.cisd.hdf5.hdf5lib.H5D.H5Dopen;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5P_DEFAULT;
+
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+
+import ch.systemsx.cisd.hdf5.cleanup.ICleanUpRegistry;
+
+/**
+ * A bounded LRU cache of open data set ids of one HDF5 file, keyed by data set path.
+ * <p>
+ * Ids handed out by {@link #open(int, String, ICleanUpRegistry)} are pinned until the registry
+ * they have been registered with is cleaned up. An id that is evicted or invalidated while pinned
+ * is closed when the last user releases it. Data spaces are not cached as their selections are
+ * per-call state.
+ *
+ * @author Bernd Rinn
+ */
+final class HDF5DataSetIdCache
+{
+
+    /** The default maximal number of data set ids kept open. */
+    static final int DEFAULT_CAPACITY = 64;
+
+    private static final class CachedDataSet
+    {
+        final int dataSetId;
+
+        int useCount;
+
+        boolean removed;
+
+        CachedDataSet(int dataSetId)
+        {
+            this.dataSetId = dataSetId;
+        }
+    }
+
+    private final Map<String, CachedDataSet> dataSets;
+
+    HDF5DataSetIdCache()
+    {
+        this(DEFAULT_CAPACITY);
+    }
+
+    HDF5DataSetIdCache(final int capacity)
+    {
+        this.dataSets = new LinkedHashMap<String, CachedDataSet>(16, 0.75f, true)
+            {
+                private static final long serialVersionUID = 1L;
+
+                @Override
+                protected boolean removeEldestEntry(Map.Entry<String, CachedDataSet> eldest)
+                {
+                    if (size() > capacity)
+                    {
+                        discard(eldest.getValue());
+                        return true;
+                    }
+                    return false;
+                }
+            };
+    }
+
+    /**
+     * Returns the id of the data set <var>path</var>, opening it if it is not yet in the cache. The
+     * id is released when <var>registry</var> is cleaned up and must not be closed by the caller.
+     */
+    synchronized int open(int fileId, String path, ICleanUpRegistry registry)
+    {
+        CachedDataSet cachedDataSet = dataSets.get(path);
+        if (cachedDataSet == null)
+        {
+            cachedDataSet = new CachedDataSet(H5Dopen(fileId, path, H5P_DEFAULT));
+            dataSets.put(path, cachedDataSet);
+        }
+        ++cachedDataSet.useCount;
+        final CachedDataSet pinnedDataSet = cachedDataSet;
+        registry.registerCleanUp(new Runnable()
+            {
+                @Override
+                public void run()
+                {
+                    release(pinnedDataSet);
+                }
+            });
+        return cachedDataSet.dataSetId;
+    }
+
+    /**
+     * Removes all data set ids from the cache. Needs to be called whenever links of the file are
+     * deleted or moved.
+     */
+    synchronized void invalidate()
+    {
+        final List<CachedDataSet> removedDataSets =
+                new ArrayList<CachedDataSet>(dataSets.values());
+        dataSets.clear();
+        for (CachedDataSet cachedDataSet : removedDataSets)
+        {
+            discard(cachedDataSet);
+        }
+    }
+
+    private synchronized void release(CachedDataSet cachedDataSet)
+    {
+        if (--cachedDataSet.useCount == 0 && cachedDataSet.removed)
+        {
+            H5Dclose(cachedDataSet.dataSetId);
+        }
+    }
+
+    private void discard(CachedDataSet cachedDataSet)
+    {
+        cachedDataSet.removed = true;
+        if (cachedDataSet.useCount == 0)
+        {
+            H5Dclose(cachedDataSet.dataSetId);
+        }
+    }
+
+}
@@ -83,7 +83,12 @@ public enum HDF5DataTypeVariant
      */
     NONE,
     
-    BITFIELD(BitSet.class);
+    BITFIELD(BitSet.class),
+
+    /**
+     * A string array stored as integer codes into a dictionary data set of its distinct values.
+     */
+    STRING_DICTIONARY(String[].class);
 
     private Set<Class<?>> compatibleTypes;
 
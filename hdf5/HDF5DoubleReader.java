@@ -22,6 +22,7 @@ import static ch.systemsx.cisd.hdf5.MatrixUtils.createFullBlockDimensionsAndOffs
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_ARRAY;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_NATIVE_DOUBLE;
 
+import java.nio.DoubleBuffer;
 import java.util.Arrays;
 import java.util.Iterator;
 
@@ -33,6 +34,8 @@ import ch.systemsx.cisd.base.mdarray.MDArray;
 import ch.systemsx.cisd.base.mdarray.MDDoubleArray;
 import ch.systemsx.cisd.hdf5.HDF5BaseReader.DataSpaceParameters;
 import ch.systemsx.cisd.hdf5.HDF5DataTypeInformation.DataTypeInfoOptions;
+import ch.systemsx.cisd.hdf5.HDF5PrefetchingIterator.IBlockReadTask;
+import ch.systemsx.cisd.hdf5.HDF5PrefetchingIterator.IBlockSource;
 import ch.systemsx.cisd.hdf5.cleanup.ICallableWithCleanUp;
 import ch.systemsx.cisd.hdf5.cleanup.ICleanUpRegistry;
 import ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants;
@@ -344,6 +347,86 @@ class HDF5DoubleReader implements IHDF5DoubleReader
         return baseReader.runner.call(readCallable);
     }
 
+    @Override
+    public int readArrayToBlockWithOffset(final String objectPath, final double[] buffer,
+            final int blockSize, final long offset, final int memoryOffset)
+    {
+        assert objectPath != null;
+        assert buffer != null;
+
+        baseReader.checkOpen();
+        final ICallableWithCleanUp<Integer> readCallable = new ICallableWithCleanUp<Integer>()
+            {
+                @Override
+                public Integer call(ICleanUpRegistry registry)
+                {
+                    final int dataSetId = 
+                            baseReader.h5.openDataSet(baseReader.fileId, objectPath, registry);
+                    final DataSpaceParameters spaceParams =
+                            baseReader.getBufferSpaceParameters(dataSetId, offset, blockSize,
+                                    buffer.length, memoryOffset, registry);
+                    baseReader.h5.readDataSet(dataSetId, H5T_NATIVE_DOUBLE, spaceParams.memorySpaceId,
+                            spaceParams.dataSpaceId, buffer);
+                    return spaceParams.blockSize;
+                }
+            };
+        return baseReader.runner.call(readCallable);
+    }
+
+    @Override
+    public int readArrayToBlockWithOffset(final HDF5DataSet dataSet, final double[] buffer,
+            final int blockSize, final long offset, final int memoryOffset)
+    {
+        assert dataSet != null;
+        assert buffer != null;
+
+        baseReader.checkOpen();
+        final ICallableWithCleanUp<Integer> readCallable = new ICallableWithCleanUp<Integer>()
+            {
+                @Override
+                public Integer call(ICleanUpRegistry registry)
+                {
+                    final DataSpaceParameters spaceParams =
+                            baseReader.getBufferSpaceParameters(dataSet, offset, blockSize,
+                                    buffer.length, memoryOffset, registry);
+                    baseReader.h5.readDataSet(dataSet.getDatasetId(), H5T_NATIVE_DOUBLE,
+                            spaceParams.memorySpaceId, spaceParams.dataSpaceId, buffer);
+                    return spaceParams.blockSize;
+                }
+            };
+        return baseReader.runner.call(readCallable);
+    }
+
+    @Override
+    public int readToBuffer(final String objectPath, final long offset, final DoubleBuffer buffer)
+    {
+        assert objectPath != null;
+        assert buffer != null;
+
+        baseReader.checkOpen();
+        if (buffer.hasRemaining() == false)
+        {
+            return 0;
+        }
+        final ICallableWithCleanUp<Integer> readCallable = new ICallableWithCleanUp<Integer>()
+            {
+                @Override
+                public Integer call(ICleanUpRegistry registry)
+                {
+                    final int dataSetId = 
+                            baseReader.h5.openDataSet(baseReader.fileId, objectPath, registry);
+                    final DataSpaceParameters spaceParams =
+                            baseReader.getSpaceParameters(dataSetId, offset, buffer.remaining(),
+                                    registry);
+                    baseReader.h5.readDataSet(dataSetId, H5T_NATIVE_DOUBLE, spaceParams.memorySpaceId,
+                            spaceParams.dataSpaceId, buffer);
+                    buffer.position(buffer.position() + spaceParams.blockSize);
+                    return spaceParams.blockSize;
+                }
+            };
+        return baseReader.runner.call(readCallable);
+    }
+
     @Override
     public double[][] readMatrix(final String objectPath) throws HDF5JavaException
     {
@@ -660,6 +743,13 @@ class HDF5DoubleReader implements IHDF5DoubleReader
     @Override
     public Iterable<HDF5DataBlock<double[]>> getArrayNaturalBlocks(final String dataSetPath)
             throws HDF5JavaException
+    {
+        return getArrayNaturalBlocks(dataSetPath, false);
+    }
+
+    @Override
+    public Iterable<HDF5DataBlock<double[]>> getArrayNaturalBlocks(final String dataSetPath,
+            final boolean reuseBuffer) throws HDF5JavaException
     {
         baseReader.checkOpen();
         final HDF5NaturalBlock1DParameters params =
@@ -677,6 +767,8 @@ class HDF5DoubleReader implements IHDF5DoubleReader
                             final HDF5NaturalBlock1DParameters.HDF5NaturalBlock1DIndex index =
                                     params.getNaturalBlockIndex();
 
+                            double[] bufferOrNull;
+
                             @Override
                             public boolean hasNext()
                             {
@@ -687,9 +779,21 @@ class HDF5DoubleReader implements IHDF5DoubleReader
                             public HDF5DataBlock<double[]> next()
                             {
                                 final long offset = index.computeOffsetAndSizeGetOffset();
-                                final double[] block =
-                                        readArrayBlockWithOffset(dataset, index
-                                                .getBlockSize(), offset);
+                                final int blockSize = index.getBlockSize();
+                                final double[] block;
+                                if (reuseBuffer)
+                                {
+                                    if (bufferOrNull == null || bufferOrNull.length != blockSize)
+                                    {
+                                        bufferOrNull = new double[blockSize];
+                                    }
+                                    readArrayToBlockWithOffset(dataset, bufferOrNull, blockSize,
+                                            offset, 0);
+                                    block = bufferOrNull;
+                                } else
+                                {
+                                    block = readArrayBlockWithOffset(dataset, blockSize, offset);
+                                }
                                 return new HDF5DataBlock<double[]>(block, index.getAndIncIndex(), 
                                         offset);
                             }
@@ -748,6 +852,154 @@ class HDF5DoubleReader implements IHDF5DoubleReader
             };
     }
 
+    @Override
+    public Iterable<HDF5DataBlock<double[]>> getArrayNaturalBlocksPrefetched(
+            final String dataSetPath, final int numberOfBlocksToPrefetch)
+            throws HDF5JavaException
+    {
+        baseReader.checkOpen();
+        final HDF5NaturalBlock1DParameters params =
+                new HDF5NaturalBlock1DParameters(baseReader.getDataSetInformation(dataSetPath));
+
+        return new Iterable<HDF5DataBlock<double[]>>()
+            {
+                @Override
+                public Iterator<HDF5DataBlock<double[]>> iterator()
+                {
+                    final HDF5DataSet dataset = baseReader.openDataSet(dataSetPath);
+                    final HDF5NaturalBlock1DParameters.HDF5NaturalBlock1DIndex index =
+                            params.getNaturalBlockIndex();
+                    final IBlockSource<HDF5DataBlock<double[]>> source =
+                            new IBlockSource<HDF5DataBlock<double[]>>()
+                                {
+                                    @Override
+                                    public boolean hasNext()
+                                    {
+                                        return index.hasNext();
+                                    }
+
+                                    @Override
+                                    public IBlockReadTask<HDF5DataBlock<double[]>> nextTask()
+                                    {
+                                        final long offset = index.computeOffsetAndSizeGetOffset();
+                                        final int blockSize = index.getBlockSize();
+                                        final long blockIndex = index.getAndIncIndex();
+                                        return new IBlockReadTask<HDF5DataBlock<double[]>>()
+                                            {
+                                                @Override
+                                                public HDF5DataBlock<double[]> read(
+                                                        HDF5DataBlock<double[]> recycledBlockOrNull)
+                                                {
+                                                    return readNaturalBlock(dataset, blockIndex,
+                                                            offset, blockSize, recycledBlockOrNull);
+                                                }
+                                            };
+                                    }
+
+                                    @Override
+                                    public void close()
+                                    {
+                                        dataset.close();
+                                    }
+                                };
+                    return new HDF5PrefetchingIterator<HDF5DataBlock<double[]>>(baseReader,
+                            source, numberOfBlocksToPrefetch);
+                }
+            };
+    }
+
+    @Override
+    public Iterable<HDF5MDDataBlock<MDDoubleArray>> getMDArrayNaturalBlocksPrefetched(
+            final String dataSetPath, final int numberOfBlocksToPrefetch)
+    {
+        baseReader.checkOpen();
+        final HDF5NaturalBlockMDParameters params =
+                new HDF5NaturalBlockMDParameters(baseReader.getDataSetInformation(dataSetPath));
+
+        return new Iterable<HDF5MDDataBlock<MDDoubleArray>>()
+            {
+                @Override
+                public Iterator<HDF5MDDataBlock<MDDoubleArray>> iterator()
+                {
+                    final HDF5NaturalBlockMDParameters.HDF5NaturalBlockMDIndex index =
+                            params.getNaturalBlockIndex();
+                    final IBlockSource<HDF5MDDataBlock<MDDoubleArray>> source =
+                            new IBlockSource<HDF5MDDataBlock<MDDoubleArray>>()
+                                {
+                                    @Override
+                                    public boolean hasNext()
+                                    {
+                                        return index.hasNext();
+                                    }
+
+                                    @Override
+                                    public IBlockReadTask<HDF5MDDataBlock<MDDoubleArray>> nextTask()
+                                    {
+                                        final long[] offset =
+                                                index.computeOffsetAndSizeGetOffsetClone();
+                                        final int[] blockSize = index.getBlockSize().clone();
+                                        final long[] blockIndex = index.getIndexClone();
+                                        return new IBlockReadTask<HDF5MDDataBlock<MDDoubleArray>>()
+                                            {
+                                                @Override
+                                                public HDF5MDDataBlock<MDDoubleArray> read(
+                                                        HDF5MDDataBlock<MDDoubleArray> recycledBlockOrNull)
+                                                {
+                                                    return readNaturalBlock(dataSetPath,
+                                                            blockIndex, offset, blockSize,
+                                                            recycledBlockOrNull);
+                                                }
+                                            };
+                                    }
+
+                                    @Override
+                                    public void close()
+                                    {
+                                        // Nothing to release.
+                                    }
+                                };
+                    return new HDF5PrefetchingIterator<HDF5MDDataBlock<MDDoubleArray>>(baseReader,
+                            source, numberOfBlocksToPrefetch);
+                }
+            };
+    }
+
+    private HDF5DataBlock<double[]> readNaturalBlock(HDF5DataSet dataset, long blockIndex,
+            long offset, int blockSize, HDF5DataBlock<double[]> recycledBlockOrNull)
+    {
+        final double[] block;
+        if (recycledBlockOrNull != null && recycledBlockOrNull.getData().length == blockSize)
+        {
+            block = recycledBlockOrNull.getData();
+        } else
+        {
+            block = new double[blockSize];
+        }
+        // The data set handle has only one data space, so reads on it must not interleave.
+        synchronized (dataset)
+        {
+            readArrayToBlockWithOffset(dataset, block, blockSize, offset, 0);
+        }
+        return new HDF5DataBlock<double[]>(block, blockIndex, offset);
+    }
+
+    private HDF5MDDataBlock<MDDoubleArray> readNaturalBlock(String dataSetPath, long[] blockIndex,
+            long[] offset, int[] blockSize, HDF5MDDataBlock<MDDoubleArray> recycledBlockOrNull)
+    {
+        final MDDoubleArray data;
+        if (recycledBlockOrNull != null
+                && Arrays.equals(recycledBlockOrNull.getData().dimensions(), blockSize))
+        {
+            data = recycledBlockOrNull.getData();
+        } else
+        {
+            data = new MDDoubleArray(blockSize);
+        }
+        readToMDArrayBlockWithOffset(dataSetPath, data, blockSize, offset,
+                new int[blockSize.length]);
+        return new HDF5MDDataBlock<MDDoubleArray>(data, blockIndex, offset);
+    }
+
     double[] getDoubleArrayAttribute(final int objectId, final String attributeName,
             ICleanUpRegistry registry)
     {
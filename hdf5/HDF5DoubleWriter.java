@@ -24,6 +24,8 @@ import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5S_ALL;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_NATIVE_DOUBLE;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_IEEE_F64LE;
 
+import java.nio.DoubleBuffer;
+
 import ch.systemsx.cisd.base.mdarray.MDArray;
 import ch.systemsx.cisd.base.mdarray.MDDoubleArray;
 import ch.systemsx.cisd.hdf5.cleanup.ICallableWithCleanUp;
@@ -197,6 +199,12 @@ class HDF5DoubleWriter extends HDF5DoubleReader implements IHDF5DoubleWriter
                             baseWriter.getOrCreateDataSetId(objectPath, 
                                 H5T_IEEE_F64LE, new long[]
                                 { data.length }, 8, features, registry);
+                    if (baseWriter.tryWriteCompressedInParallel(objectPath, dataSetId,
+                            H5T_NATIVE_DOUBLE, null, new long[]
+                                { data.length }, data, registry))
+                    {
+                        return null; // Nothing to return.
+                    }
                     H5Dwrite(dataSetId, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, 
                             data);
                     return null; // Nothing to return.
@@ -325,6 +333,10 @@ class HDF5DoubleWriter extends HDF5DoubleReader implements IHDF5DoubleWriter
         assert objectPath != null;
         assert data != null;
 
+        if (baseWriter.tryWriteBehind(objectPath, H5T_NATIVE_DOUBLE, data, dataSize, offset))
+        {
+            return;
+        }
         baseWriter.checkOpen();
         final ICallableWithCleanUp<Void> writeRunnable = new ICallableWithCleanUp<Void>()
             {
@@ -339,6 +351,11 @@ class HDF5DoubleWriter extends HDF5DoubleReader implements IHDF5DoubleWriter
                             baseWriter.h5.openAndExtendDataSet(baseWriter.fileId, objectPath,
                                     baseWriter.fileFormat, new long[]
                                         { offset + dataSize }, -1, registry);
+                    if (baseWriter.tryWriteCompressedInParallel(objectPath, dataSetId,
+                            H5T_NATIVE_DOUBLE, slabStartOrNull, blockDimensions, data, registry))
+                    {
+                        return null; // Nothing to return.
+                    }
                     final int dataSpaceId = 
                             baseWriter.h5.getDataSpaceForDataSet(dataSetId, registry);
                     baseWriter.h5.setHyperslabBlock(dataSpaceId, slabStartOrNull, blockDimensions);
@@ -377,6 +394,12 @@ class HDF5DoubleWriter extends HDF5DoubleReader implements IHDF5DoubleWriter
                     {
                         dataSet.setDimensions(requiredDimensions);
                     }
+                    if (baseWriter.tryWriteCompressedInParallel(dataSet.getDatasetPath(),
+                            dataSet.getDatasetId(), H5T_NATIVE_DOUBLE, slabStartOrNull,
+                            blockDimensions, data, registry))
+                    {
+                        return null; // Nothing to return.
+                    }
                     final int dataSpaceId =
                             baseWriter.h5.getDataSpaceForDataSet(dataSet.getDatasetId(), registry);
                     baseWriter.h5.setHyperslabBlock(dataSpaceId, slabStartOrNull, blockDimensions);
@@ -390,6 +413,46 @@ class HDF5DoubleWriter extends HDF5DoubleReader implements IHDF5DoubleWriter
         baseWriter.runner.call(writeRunnable);
     }
 
+    @Override
+    public void writeFromBuffer(final String objectPath, final long offset,
+            final DoubleBuffer buffer)
+    {
+        assert objectPath != null;
+        assert buffer != null;
+
+        baseWriter.checkOpen();
+        final int dataSize = buffer.remaining();
+        if (dataSize == 0)
+        {
+            return;
+        }
+        final ICallableWithCleanUp<Void> writeRunnable = new ICallableWithCleanUp<Void>()
+            {
+                @Override
+                public Void call(ICleanUpRegistry registry)
+                {
+                    final long[] blockDimensions = new long[]
+                        { dataSize };
+                    final long[] slabStartOrNull = new long[]
+                        { offset };
+                    final int dataSetId =
+                            baseWriter.h5.openAndExtendDataSet(baseWriter.fileId, objectPath,
+                                    baseWriter.fileFormat, new long[]
+                                        { offset + dataSize }, -1, registry);
+                    final int dataSpaceId =
+                            baseWriter.h5.getDataSpaceForDataSet(dataSetId, registry);
+                    baseWriter.h5.setHyperslabBlock(dataSpaceId, slabStartOrNull, blockDimensions);
+                    final int memorySpaceId =
+                            baseWriter.h5.createSimpleDataSpace(blockDimensions, registry);
+                    baseWriter.h5.writeDataSet(dataSetId, H5T_NATIVE_DOUBLE, memorySpaceId,
+                            dataSpaceId, buffer);
+                    return null; // Nothing to return.
+                }
+            };
+        baseWriter.runner.call(writeRunnable);
+        buffer.position(buffer.limit());
+    }
+
     /**
      * Writes out a <code>double</code> matrix (array of rank 2).
      * 
@@ -547,6 +610,12 @@ class HDF5DoubleWriter extends HDF5DoubleReader implements IHDF5DoubleWriter
                     final int dataSetId =
                             baseWriter.getOrCreateDataSetId(objectPath, H5T_IEEE_F64LE, 
                                     data.longDimensions(), 8, features, registry);
+                    if (baseWriter.tryWriteCompressedInParallel(objectPath, dataSetId,
+                            H5T_NATIVE_DOUBLE, null, data.longDimensions(), data.getAsFlatArray(),
+                            registry))
+                    {
+                        return null; // Nothing to return.
+                    }
                     H5Dwrite(dataSetId, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, 
                             data.getAsFlatArray());
                     return null; // Nothing to return.
@@ -690,6 +759,11 @@ class HDF5DoubleWriter extends HDF5DoubleReader implements IHDF5DoubleWriter
                     final int dataSetId =
                             baseWriter.h5.openAndExtendDataSet(baseWriter.fileId, objectPath,
                                     baseWriter.fileFormat, dataSetDimensions, -1, registry);
+                    if (baseWriter.tryWriteCompressedInParallel(objectPath, dataSetId,
+                            H5T_NATIVE_DOUBLE, offset, dimensions, data.getAsFlatArray(), registry))
+                    {
+                        return null; // Nothing to return.
+                    }
                     final int dataSpaceId = 
                             baseWriter.h5.getDataSpaceForDataSet(dataSetId, registry);
                     baseWriter.h5.setHyperslabBlock(dataSpaceId, offset, dimensions);
@@ -792,4 +792,207 @@ class HDF5EnumReader implements IHDF5EnumReader
         return getMDArrayBlocks(objectPath, null);
     }
 
+    @Override
+    public byte[] readByteOrdinalArray(final String objectPath) throws HDF5JavaException
+    {
+        return (byte[]) primReadOrdinalArray(objectPath, -1, -1, EnumStorageForm.BYTE);
+    }
+
+    @Override
+    public short[] readShortOrdinalArray(final String objectPath) throws HDF5JavaException
+    {
+        return (short[]) primReadOrdinalArray(objectPath, -1, -1, EnumStorageForm.SHORT);
+    }
+
+    @Override
+    public int[] readIntOrdinalArray(final String objectPath) throws HDF5JavaException
+    {
+        return (int[]) primReadOrdinalArray(objectPath, -1, -1, EnumStorageForm.INT);
+    }
+
+    @Override
+    public byte[] readByteOrdinalArrayBlockWithOffset(final String objectPath,
+            final int blockSize, final long offset) throws HDF5JavaException
+    {
+        return (byte[]) primReadOrdinalArray(objectPath, blockSize, offset, EnumStorageForm.BYTE);
+    }
+
+    @Override
+    public short[] readShortOrdinalArrayBlockWithOffset(final String objectPath,
+            final int blockSize, final long offset) throws HDF5JavaException
+    {
+        return (short[]) primReadOrdinalArray(objectPath, blockSize, offset,
+                EnumStorageForm.SHORT);
+    }
+
+    @Override
+    public int[] readIntOrdinalArrayBlockWithOffset(final String objectPath, final int blockSize,
+            final long offset) throws HDF5JavaException
+    {
+        return (int[]) primReadOrdinalArray(objectPath, blockSize, offset, EnumStorageForm.INT);
+    }
+
+    @Override
+    public Iterable<HDF5DataBlock<byte[]>> getByteOrdinalArrayBlocks(final String objectPath)
+            throws HDF5JavaException
+    {
+        return primGetOrdinalArrayBlocks(objectPath, EnumStorageForm.BYTE);
+    }
+
+    @Override
+    public Iterable<HDF5DataBlock<short[]>> getShortOrdinalArrayBlocks(final String objectPath)
+            throws HDF5JavaException
+    {
+        return primGetOrdinalArrayBlocks(objectPath, EnumStorageForm.SHORT);
+    }
+
+    @Override
+    public Iterable<HDF5DataBlock<int[]>> getIntOrdinalArrayBlocks(final String objectPath)
+            throws HDF5JavaException
+    {
+        return primGetOrdinalArrayBlocks(objectPath, EnumStorageForm.INT);
+    }
+
+    private <T> Iterable<HDF5DataBlock<T>> primGetOrdinalArrayBlocks(final String objectPath,
+            final EnumStorageForm ordinalForm) throws HDF5JavaException
+    {
+        baseReader.checkOpen();
+        final HDF5NaturalBlock1DParameters params =
+                new HDF5NaturalBlock1DParameters(baseReader.getDataSetInformation(objectPath));
+
+        return new Iterable<HDF5DataBlock<T>>()
+            {
+                @Override
+                public Iterator<HDF5DataBlock<T>> iterator()
+                {
+                    return new Iterator<HDF5DataBlock<T>>()
+                        {
+                            final HDF5NaturalBlock1DParameters.HDF5NaturalBlock1DIndex index =
+                                    params.getNaturalBlockIndex();
+
+                            @Override
+                            public boolean hasNext()
+                            {
+                                return index.hasNext();
+                            }
+
+                            @Override
+                            public HDF5DataBlock<T> next()
+                            {
+                                final long offset = index.computeOffsetAndSizeGetOffset();
+                                @SuppressWarnings("unchecked")
+                                final T block =
+                                        (T) primReadOrdinalArray(objectPath,
+                                                index.getBlockSize(), offset, ordinalForm);
+                                return new HDF5DataBlock<T>(block, index.getAndIncIndex(), offset);
+                            }
+
+                            @Override
+                            public void remove()
+                            {
+                                throw new UnsupportedOperationException();
+                            }
+                        };
+                }
+            };
+    }
+
+    /**
+     * Reads the ordinals of a block of an enum array into an array of the primitive type of
+     * <var>ordinalForm</var>. The ordinals are read in the storage form of the data set and widened
+     * if <var>ordinalForm</var> is wider.
+     */
+    private Object primReadOrdinalArray(final String objectPath, final int blockSize,
+            final long offset, final EnumStorageForm ordinalForm) throws HDF5JavaException
+    {
+        assert objectPath != null;
+
+        baseReader.checkOpen();
+        final ICallableWithCleanUp<Object> readRunnable = new ICallableWithCleanUp<Object>()
+            {
+                @Override
+                public Object call(ICleanUpRegistry registry)
+                {
+                    final int dataSetId =
+                            baseReader.h5.openDataSet(baseReader.fileId, objectPath, registry);
+                    final boolean scaledEnum = baseReader.isScaledEnum(dataSetId, registry);
+                    final HDF5EnumerationType enumType =
+                            getEnumTypeForDataSetId(dataSetId, objectPath, scaledEnum, registry);
+                    final EnumStorageForm storageForm = enumType.getStorageForm();
+                    if (storageForm.getStorageSize() > ordinalForm.getStorageSize())
+                    {
+                        throw new HDF5JavaException("Enum data set '" + objectPath
+                                + "' has storage form " + storageForm
+                                + " and cannot be read as ordinals of storage form "
+                                + ordinalForm + ".");
+                    }
+                    final DataSpaceParameters spaceParams =
+                            baseReader.getSpaceParameters(dataSetId, offset, blockSize, registry);
+                    final int memoryTypeId =
+                            scaledEnum ? storageForm.getIntNativeTypeId() : enumType
+                                    .getNativeTypeId();
+                    switch (storageForm)
+                    {
+                        case BYTE:
+                        {
+                            final byte[] ordinals = new byte[spaceParams.blockSize];
+                            baseReader.h5.readDataSet(dataSetId, memoryTypeId,
+                                    spaceParams.memorySpaceId, spaceParams.dataSpaceId, ordinals);
+                            return (ordinalForm == EnumStorageForm.BYTE) ? ordinals
+                                    : widen(ordinals, ordinalForm);
+                        }
+                        case SHORT:
+                        {
+                            final short[] ordinals = new short[spaceParams.blockSize];
+                            baseReader.h5.readDataSet(dataSetId, memoryTypeId,
+                                    spaceParams.memorySpaceId, spaceParams.dataSpaceId, ordinals);
+                            return (ordinalForm == EnumStorageForm.SHORT) ? ordinals
+                                    : widen(ordinals);
+                        }
+                        case INT:
+                        {
+                            final int[] ordinals = new int[spaceParams.blockSize];
+                            baseReader.h5.readDataSet(dataSetId, memoryTypeId,
+                                    spaceParams.memorySpaceId, spaceParams.dataSpaceId, ordinals);
+                            return ordinals;
+                        }
+                        default:
+                            throw new Error("Illegal storage form (" + storageForm + ".)");
+                    }
+                }
+            };
+        return baseReader.runner.call(readRunnable);
+    }
+
+    private static Object widen(byte[] ordinals, EnumStorageForm ordinalForm)
+    {
+        if (ordinalForm == EnumStorageForm.SHORT)
+        {
+            final short[] result = new short[ordinals.length];
+            for (int i = 0; i < ordinals.length; ++i)
+            {
+                result[i] = ordinals[i];
+            }
+            return result;
+        } else
+        {
+            final int[] result = new int[ordinals.length];
+            for (int i = 0; i < ordinals.length; ++i)
+            {
+                result[i] = ordinals[i];
+            }
+            return result;
+        }
+    }
+
+    private static int[] widen(short[] ordinals)
+    {
+        final int[] result = new int[ordinals.length];
+        for (int i = 0; i < ordinals.length; ++i)
+        {
+            result[i] = ordinals[i];
+        }
+        return result;
+    }
+
 }
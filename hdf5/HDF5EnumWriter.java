@@ -521,8 +521,8 @@ class HDF5EnumWriter extends HDF5EnumReader implements IHDF5EnumWriter
                                         .getIntStorageTypeId(), new long[]
                                     { data.getLength() }, data.getStorageForm().getStorageSize(),
                                         actualFeatures, registry);
-                        H5Dwrite(dataSetId, data.getType().getIntNativeTypeId(), H5S_ALL, H5S_ALL,
-                                H5P_DEFAULT, data.toStorageForm());
+                        writeOrdinals(dataSetId, data.getType().getIntNativeTypeId(), H5S_ALL,
+                                H5S_ALL, data);
                         baseWriter.setTypeVariant(dataSetId, HDF5DataTypeVariant.ENUM, registry);
                         baseWriter.setStringAttribute(dataSetId, HDF5Utils
                                 .getEnumTypeNameAttributeName(baseWriter.houseKeepingNameSuffix),
@@ -535,8 +535,8 @@ class HDF5EnumWriter extends HDF5EnumReader implements IHDF5EnumWriter
                                         .getStorageTypeId(), new long[]
                                     { data.getLength() }, data.getStorageForm().getStorageSize(),
                                         features, registry);
-                        H5Dwrite(dataSetId, data.getType().getNativeTypeId(), H5S_ALL, H5S_ALL,
-                                H5P_DEFAULT, data.toStorageForm());
+                        writeOrdinals(dataSetId, data.getType().getNativeTypeId(), H5S_ALL,
+                                H5S_ALL, data);
                     }
                     return null; // Nothing to return.
                 }
@@ -544,6 +544,62 @@ class HDF5EnumWriter extends HDF5EnumReader implements IHDF5EnumWriter
         baseWriter.runner.call(writeRunnable);
     }
 
+    @Override
+    public HDF5EnumerationType writeOrdinalArray(final String objectPath,
+            final EnumerationType enumType, final byte[] ordinals,
+            final HDF5IntStorageFeatures features) throws IllegalArgumentException
+    {
+        final HDF5EnumerationType type = getType(enumType);
+        writeArray(objectPath, new HDF5EnumerationValueArray(type, ordinals), features);
+        return type;
+    }
+
+    @Override
+    public HDF5EnumerationType writeOrdinalArray(final String objectPath,
+            final EnumerationType enumType, final short[] ordinals,
+            final HDF5IntStorageFeatures features) throws IllegalArgumentException
+    {
+        final HDF5EnumerationType type = getType(enumType);
+        writeArray(objectPath, new HDF5EnumerationValueArray(type, ordinals), features);
+        return type;
+    }
+
+    @Override
+    public HDF5EnumerationType writeOrdinalArray(final String objectPath,
+            final EnumerationType enumType, final int[] ordinals,
+            final HDF5IntStorageFeatures features) throws IllegalArgumentException
+    {
+        final HDF5EnumerationType type = getType(enumType);
+        writeArray(objectPath, new HDF5EnumerationValueArray(type, ordinals), features);
+        return type;
+    }
+
+    /**
+     * Writes the ordinals of <var>data</var> in their storage form, without converting them to
+     * bytes first.
+     */
+    private static void writeOrdinals(int dataSetId, int memoryTypeId, int memorySpaceId,
+            int fileSpaceId, HDF5EnumerationValueArray data)
+    {
+        switch (data.getStorageForm())
+        {
+            case BYTE:
+                H5Dwrite(dataSetId, memoryTypeId, memorySpaceId, fileSpaceId, H5P_DEFAULT,
+                        data.getStorageFormBArray());
+                break;
+            case SHORT:
+                H5Dwrite(dataSetId, memoryTypeId, memorySpaceId, fileSpaceId, H5P_DEFAULT,
+                        data.getStorageFormSArray());
+                break;
+            case INT:
+                H5Dwrite(dataSetId, memoryTypeId, memorySpaceId, fileSpaceId, H5P_DEFAULT,
+                        data.getStorageFormIArray());
+                break;
+            default:
+                throw new Error("Illegal storage form (" + data.getStorageForm() + ".)");
+        }
+    }
+
     @Override
     public HDF5EnumerationType createArray(final String objectPath,
             final HDF5EnumerationType enumType, final int size)
@@ -700,12 +756,12 @@ class HDF5EnumWriter extends HDF5EnumReader implements IHDF5EnumWriter
                             baseWriter.h5.createSimpleDataSpace(blockDimensions, registry);
                     if (baseWriter.isScaledEnum(dataSetId, registry))
                     {
-                        H5Dwrite(dataSetId, data.getType().getIntNativeTypeId(), memorySpaceId,
-                                dataSpaceId, H5P_DEFAULT, data.toStorageForm());
+                        writeOrdinals(dataSetId, data.getType().getIntNativeTypeId(),
+                                memorySpaceId, dataSpaceId, data);
                     } else
                     {
-                        H5Dwrite(dataSetId, data.getType().getNativeTypeId(), memorySpaceId,
-                                dataSpaceId, H5P_DEFAULT, data.toStorageForm());
+                        writeOrdinals(dataSetId, data.getType().getNativeTypeId(), memorySpaceId,
+                                dataSpaceId, data);
                     }
                     return null; // Nothing to return.
                 }
@@ -47,6 +47,30 @@ public final class HDF5Factory
         return HDF5FactoryProvider.get().open(new File(filePath));
     }
 
+    /**
+     * Opens an HDF5 file named <var>name</var> for writing and reading that is kept in memory and
+     * discarded when the writer is closed. Nothing is read from or written to disk.
+     */
+    public static IHDF5Writer openInMemory(String name)
+    {
+        return HDF5FactoryProvider.get().openInMemory(name);
+    }
+
+    /**
+     * Opens a configurator for an HDF5 file named <var>filePath</var> that is kept in memory. The
+     * memory is allocated and grown in steps of <var>initialSize</var> bytes. If
+     * <var>backingStore</var> is <code>true</code>, the file is written to <var>filePath</var> when
+     * the writer is closed, replacing an existing file, otherwise it is discarded. Configure the
+     * writer as you need and then call {@link IHDF5WriterConfigurator#writer()} in order to start
+     * reading and writing the file.
+     */
+    public static IHDF5WriterConfigurator configureInMemory(String filePath, int initialSize,
+            boolean backingStore)
+    {
+        return HDF5FactoryProvider.get().configureInMemory(new File(filePath), initialSize,
+                backingStore);
+    }
+
     /**
      * Opens an HDF5 <var>file</var> for reading. It is an error if the file does not exist.
      */
@@ -30,6 +30,11 @@ public final class HDF5FactoryProvider
     private static class HDF5Factory implements IHDF5Factory
     {
 
+        /**
+         * The default step in which the memory of in-memory files is grown.
+         */
+        private static final int DEFAULT_IN_MEMORY_INCREMENT = 1024 * 1024;
+
         @Override
         public IHDF5WriterConfigurator configure(File file)
         {
@@ -48,6 +53,21 @@ public final class HDF5FactoryProvider
             return new HDF5WriterConfigurator(file).writer();
         }
 
+        @Override
+        public IHDF5Writer openInMemory(String name)
+        {
+            return configureInMemory(new File(name), DEFAULT_IN_MEMORY_INCREMENT, false)
+                    .writer();
+        }
+
+        @Override
+        public IHDF5WriterConfigurator configureInMemory(File file, int initialSize,
+                boolean backingStore)
+        {
+            return new HDF5WriterConfigurator(file).overwrite().inMemory(initialSize,
+                    backingStore);
+        }
+
         @Override
         public IHDF5Reader openForReading(File file)
         {
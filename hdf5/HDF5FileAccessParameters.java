@@ -0,0 +1,160 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5;
+
+/**
+ * The parameters of the file access property list that control how the library allocates space
+ * in the file, how much metadata it caches and whether the file is kept in memory. A value of
+ * <code>-1</code> means to keep the library default.
+ *
+ * @author Bernd Rinn
+ */
+final class HDF5FileAccessParameters
+{
+
+    private final long smallDataBlockSize;
+
+    private final long alignmentThreshold;
+
+    private final long alignment;
+
+    private final long metaBlockSize;
+
+    private final long metaDataCacheSize;
+
+    private final int inMemoryIncrement;
+
+    private final boolean backingStore;
+
+    /**
+     * Creates parameters that only set the size of the metadata cache, as used by readers.
+     */
+    HDF5FileAccessParameters(long metaDataCacheSize)
+    {
+        this(-1, -1, -1, -1, metaDataCacheSize, -1, false);
+    }
+
+    HDF5FileAccessParameters(long smallDataBlockSize, long alignmentThreshold, long alignment,
+            long metaBlockSize, long metaDataCacheSize, int inMemoryIncrement,
+            boolean backingStore)
+    {
+        this.smallDataBlockSize = smallDataBlockSize;
+        this.alignmentThreshold = alignmentThreshold;
+        this.alignment = alignment;
+        this.metaBlockSize = metaBlockSize;
+        this.metaDataCacheSize = metaDataCacheSize;
+        this.inMemoryIncrement = inMemoryIncrement;
+        this.backingStore = backingStore;
+    }
+
+    /**
+     * Returns <code>true</code>, if all parameters are the library defaults.
+     */
+    boolean isDefault()
+    {
+        return smallDataBlockSize < 0 && alignment < 0 && metaBlockSize < 0
+                && metaDataCacheSize < 0 && isInMemory() == false;
+    }
+
+    /**
+     * Returns the size of the blocks that small contiguous data sets are aggregated in, or
+     * <code>-1</code> for the library default of 2048 bytes.
+     */
+    long getSmallDataBlockSize()
+    {
+        return smallDataBlockSize;
+    }
+
+    /**
+     * Returns the size from which on objects are aligned. Only meaningful if
+     * {@link #getAlignment()} is not <code>-1</code>.
+     */
+    long getAlignmentThreshold()
+    {
+        return alignmentThreshold;
+    }
+
+    /**
+     * Returns the alignment of objects, or <code>-1</code> for the library default of no
+     * alignment.
+     */
+    long getAlignment()
+    {
+        return alignment;
+    }
+
+    /**
+     * Returns the minimum size of the blocks that metadata is allocated in, or <code>-1</code> for
+     * the library default of 2048 bytes.
+     */
+    long getMetaBlockSize()
+    {
+        return metaBlockSize;
+    }
+
+    /**
+     * Returns the maximum size of the metadata cache, or <code>-1</code> for the library default.
+     */
+    long getMetaDataCacheSize()
+    {
+        return metaDataCacheSize;
+    }
+
+    /**
+     * Returns <code>true</code>, if the file is kept in memory by the core driver.
+     */
+    boolean isInMemory()
+    {
+        return inMemoryIncrement > 0;
+    }
+
+    /**
+     * Returns the number of bytes by which the memory of an in-memory file is grown, or
+     * <code>-1</code>, if the file is not kept in memory.
+     */
+    int getInMemoryIncrement()
+    {
+        return inMemoryIncrement;
+    }
+
+    /**
+     * Returns <code>true</code>, if an in-memory file is written to disk when it is closed.
+     */
+    boolean isBackingStore()
+    {
+        return backingStore;
+    }
+
+    /**
+     * Returns <code>true</code>, if the file is kept in memory and never written to disk.
+     */
+    boolean isDiskless()
+    {
+        return isInMemory() && backingStore == false;
+    }
+
+    @Override
+    public String toString()
+    {
+        return "HDF5FileAccessParameters [smallDataBlockSize=" + smallDataBlockSize
+                + ", alignmentThreshold=" + alignmentThreshold + ", alignment=" + alignment
+                + ", metaBlockSize=" + metaBlockSize + ", metaDataCacheSize=" + metaDataCacheSize
+                + ", inMemoryIncrement=" + inMemoryIncrement + ", backingStore=" + backingStore
+                + "]";
+    }
+
+}
@@ -17,6 +17,7 @@
 package ch.systemsx.cisd.hdf5;
 
 import java.io.Flushable;
+import java.util.concurrent.Future;
 
 import ch.systemsx.cisd.hdf5.IHDF5WriterConfigurator.FileFormat;
 
@@ -71,6 +72,25 @@ final class HDF5FileLevelReadWriteHandler extends HDF5FileLevelReadOnlyHandler i
         baseWriter.flushSyncBlocking();
     }
 
+    @Override
+    public Future<Void> flushAsync()
+    {
+        baseWriter.checkOpen();
+        return baseWriter.flushAsync();
+    }
+
+    @Override
+    public HDF5SyncStatistics getSyncStatistics()
+    {
+        return baseWriter.getSyncStatistics();
+    }
+
+    @Override
+    public HDF5SyncStatistics getGlobalSyncStatistics()
+    {
+        return HDF5BaseWriter.getGlobalSyncStatistics();
+    }
+
     @Override
     public boolean addFlushable(Flushable flushable)
     {
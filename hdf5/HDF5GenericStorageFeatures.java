@@ -366,6 +366,101 @@ public final class HDF5GenericStorageFeatures extends HDF5AbstractStorageFeature
             return this;
         }
 
+        /**
+         * Compresses the dataset with the LZ4 filter plugin. Cannot be combined with deflation.
+         * 
+         * @return This builder.
+         */
+        @Override
+        public HDF5GenericStorageFeatureBuilder lz4()
+        {
+            super.lz4();
+            return this;
+        }
+
+        /**
+         * Compresses the dataset with the Zstandard filter plugin with the default level
+         * {@link #DEFAULT_ZSTD_LEVEL}. Cannot be combined with deflation.
+         * 
+         * @return This builder.
+         */
+        @Override
+        public HDF5GenericStorageFeatureBuilder zstd()
+        {
+            super.zstd();
+            return this;
+        }
+
+        /**
+         * Compresses the dataset with the Zstandard filter plugin with the given
+         * <var>zstdLevel</var>, which needs to be between {@link #MIN_ZSTD_LEVEL} and
+         * {@link #MAX_ZSTD_LEVEL}. Cannot be combined with deflation.
+         * 
+         * @return This builder.
+         */
+        @Override
+        public HDF5GenericStorageFeatureBuilder zstd(byte zstdLevel)
+        {
+            super.zstd(zstdLevel);
+            return this;
+        }
+
+        /**
+         * Sets a bitshuffle pre-filter if <code>bitshuffle==true</code> and disables it if
+         * <code>bitshuffle==false</code>. If combined with {@link #lz4()} or {@link #zstd()}, the
+         * bitshuffle filter plugin does the compression itself. Cannot be combined with
+         * deflation or shuffling.
+         * 
+         * @return This builder.
+         */
+        @Override
+        public HDF5GenericStorageFeatureBuilder bitshuffle(boolean bitshuffle)
+        {
+            super.bitshuffle(bitshuffle);
+            return this;
+        }
+
+        /**
+         * Sets a bitshuffle pre-filter. This usually improves the compression ratio of numeric
+         * data considerably more than the byte shuffle of {@link #shuffleBeforeDeflate()}. Cannot
+         * be combined with deflation or shuffling.
+         * 
+         * @return This builder.
+         */
+        @Override
+        public HDF5GenericStorageFeatureBuilder bitshuffle()
+        {
+            super.bitshuffle();
+            return this;
+        }
+
+        /**
+         * Sets the access pattern that the chunk shape is planned for, if no chunk size is given
+         * explicitly. The default is {@link ChunkAccessPattern#TILES}.
+         * 
+         * @return This builder.
+         */
+        @Override
+        public HDF5GenericStorageFeatureBuilder chunkAccessPattern(
+                ChunkAccessPattern chunkAccessPattern)
+        {
+            super.chunkAccessPattern(chunkAccessPattern);
+            return this;
+        }
+
+        /**
+         * Sets the size in bytes that chunks are planned to have, if no chunk size is given
+         * explicitly. The default is {@link #DEFAULT_CHUNK_TARGET_SIZE}.
+         * 
+         * @return This builder.
+         */
+        @Override
+        public HDF5GenericStorageFeatureBuilder chunkTargetSize(int chunkTargetSize)
+        {
+            super.chunkTargetSize(chunkTargetSize);
+            return this;
+        }
+
         /**
          * Set the layout for the dataset.
          * 
@@ -509,8 +604,7 @@ public final class HDF5GenericStorageFeatures extends HDF5AbstractStorageFeature
 
     HDF5GenericStorageFeatures(HDF5GenericStorageFeatureBuilder builder)
     {
-        super(builder.getStorageLayout(), builder.getDatasetReplacementPolicy(), builder
-                .isShuffleBeforeDeflate(), builder.getDeflateLevel(), builder.getScalingFactor());
+        super(builder);
     }
 
     HDF5GenericStorageFeatures(HDF5StorageLayout proposedLayoutOrNull, byte deflateLevel,
@@ -663,6 +663,101 @@ public final class HDF5IntStorageFeatures extends HDF5AbstractStorageFeatures
             return this;
         }
 
+        /**
+         * Compresses the dataset with the LZ4 filter plugin. Cannot be combined with deflation.
+         * 
+         * @return This builder.
+         */
+        @Override
+        public HDF5IntStorageFeatureBuilder lz4()
+        {
+            super.lz4();
+            return this;
+        }
+
+        /**
+         * Compresses the dataset with the Zstandard filter plugin with the default level
+         * {@link #DEFAULT_ZSTD_LEVEL}. Cannot be combined with deflation.
+         * 
+         * @return This builder.
+         */
+        @Override
+        public HDF5IntStorageFeatureBuilder zstd()
+        {
+            super.zstd();
+            return this;
+        }
+
+        /**
+         * Compresses the dataset with the Zstandard filter plugin with the given
+         * <var>zstdLevel</var>, which needs to be between {@link #MIN_ZSTD_LEVEL} and
+         * {@link #MAX_ZSTD_LEVEL}. Cannot be combined with deflation.
+         * 
+         * @return This builder.
+         */
+        @Override
+        public HDF5IntStorageFeatureBuilder zstd(byte zstdLevel)
+        {
+            super.zstd(zstdLevel);
+            return this;
+        }
+
+        /**
+         * Sets a bitshuffle pre-filter if <code>bitshuffle==true</code> and disables it if
+         * <code>bitshuffle==false</code>. If combined with {@link #lz4()} or {@link #zstd()}, the
+         * bitshuffle filter plugin does the compression itself. Cannot be combined with
+         * deflation, shuffling or scaling.
+         * 
+         * @return This builder.
+         */
+        @Override
+        public HDF5IntStorageFeatureBuilder bitshuffle(boolean bitshuffle)
+        {
+            super.bitshuffle(bitshuffle);
+            return this;
+        }
+
+        /**
+         * Sets a bitshuffle pre-filter. This usually improves the compression ratio of numeric
+         * data considerably more than the byte shuffle of {@link #shuffleBeforeDeflate()}. Cannot
+         * be combined with deflation, shuffling or scaling.
+         * 
+         * @return This builder.
+         */
+        @Override
+        public HDF5IntStorageFeatureBuilder bitshuffle()
+        {
+            super.bitshuffle();
+            return this;
+        }
+
+        /**
+         * Sets the access pattern that the chunk shape is planned for, if no chunk size is given
+         * explicitly. The default is {@link ChunkAccessPattern#TILES}.
+         * 
+         * @return This builder.
+         */
+        @Override
+        public HDF5IntStorageFeatureBuilder chunkAccessPattern(
+                ChunkAccessPattern chunkAccessPattern)
+        {
+            super.chunkAccessPattern(chunkAccessPattern);
+            return this;
+        }
+
+        /**
+         * Sets the size in bytes that chunks are planned to have, if no chunk size is given
+         * explicitly. The default is {@link #DEFAULT_CHUNK_TARGET_SIZE}.
+         * 
+         * @return This builder.
+         */
+        @Override
+        public HDF5IntStorageFeatureBuilder chunkTargetSize(int chunkTargetSize)
+        {
+            super.chunkTargetSize(chunkTargetSize);
+            return this;
+        }
+
         /**
          * Set the layout for the dataset.
          * 
@@ -867,9 +962,7 @@ public final class HDF5IntStorageFeatures extends HDF5AbstractStorageFeatures
             return HDF5IntStorageFeatures.INT_DEFLATE_MAX_KEEP;
         } else
         {
-            return new HDF5IntStorageFeatures(storageFeatures.tryGetProposedLayout(),
-                    storageFeatures.getDatasetReplacementPolicy(),
-                    storageFeatures.getDeflateLevel(), NO_SCALING_FACTOR, true);
+            return new HDF5IntStorageFeatureBuilder(storageFeatures).noScaling().features();
         }
     }
 
@@ -936,9 +1029,7 @@ public final class HDF5IntStorageFeatures extends HDF5AbstractStorageFeatures
             return HDF5IntStorageFeatures.INT_DEFLATE_MAX_UNSIGNED_KEEP;
         } else
         {
-            return new HDF5IntStorageFeatures(storageFeatures.tryGetProposedLayout(),
-                    storageFeatures.getDatasetReplacementPolicy(),
-                    storageFeatures.getDeflateLevel(), NO_SCALING_FACTOR, true);
+            return new HDF5IntStorageFeatureBuilder(storageFeatures).noScaling().features();
         }
     }
 
@@ -1195,8 +1286,7 @@ public final class HDF5IntStorageFeatures extends HDF5AbstractStorageFeatures
 
     HDF5IntStorageFeatures(HDF5IntStorageFeatureBuilder builder)
     {
-        super(builder.getStorageLayout(), builder.getDatasetReplacementPolicy(), builder
-                .isShuffleBeforeDeflate(), builder.getDeflateLevel(), builder.getScalingFactor());
+        super(builder);
         this.signed = builder.isSigned();
     }
 
@@ -25,6 +25,8 @@ import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_NATIVE_INT64;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_STD_I64LE;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_STD_U64LE;
 
+import java.nio.LongBuffer;
+
 import ch.systemsx.cisd.base.mdarray.MDArray;
 import ch.systemsx.cisd.base.mdarray.MDLongArray;
 import ch.systemsx.cisd.hdf5.cleanup.ICallableWithCleanUp;
@@ -198,6 +200,12 @@ class HDF5LongWriter extends HDF5LongReader implements IHDF5LongWriter
                             baseWriter.getOrCreateDataSetId(objectPath, 
                                 features.isSigned() ? H5T_STD_I64LE : H5T_STD_U64LE, new long[]
                                 { data.length }, 8, features, registry);
+                    if (baseWriter.tryWriteCompressedInParallel(objectPath, dataSetId,
+                            H5T_NATIVE_INT64, null, new long[]
+                                { data.length }, data, registry))
+                    {
+                        return null; // Nothing to return.
+                    }
                     H5Dwrite(dataSetId, H5T_NATIVE_INT64, H5S_ALL, H5S_ALL, H5P_DEFAULT, 
                             data);
                     return null; // Nothing to return.
@@ -326,6 +334,10 @@ class HDF5LongWriter extends HDF5LongReader implements IHDF5LongWriter
         assert objectPath != null;
         assert data != null;
 
+        if (baseWriter.tryWriteBehind(objectPath, H5T_NATIVE_INT64, data, dataSize, offset))
+        {
+            return;
+        }
         baseWriter.checkOpen();
         final ICallableWithCleanUp<Void> writeRunnable = new ICallableWithCleanUp<Void>()
             {
@@ -340,6 +352,11 @@ class HDF5LongWriter extends HDF5LongReader implements IHDF5LongWriter
                             baseWriter.h5.openAndExtendDataSet(baseWriter.fileId, objectPath,
                                     baseWriter.fileFormat, new long[]
                                         { offset + dataSize }, -1, registry);
+                    if (baseWriter.tryWriteCompressedInParallel(objectPath, dataSetId,
+                            H5T_NATIVE_INT64, slabStartOrNull, blockDimensions, data, registry))
+                    {
+                        return null; // Nothing to return.
+                    }
                     final int dataSpaceId = 
                             baseWriter.h5.getDataSpaceForDataSet(dataSetId, registry);
                     baseWriter.h5.setHyperslabBlock(dataSpaceId, slabStartOrNull, blockDimensions);
@@ -378,6 +395,12 @@ class HDF5LongWriter extends HDF5LongReader implements IHDF5LongWriter
                     {
                         dataSet.setDimensions(requiredDimensions);
                     }
+                    if (baseWriter.tryWriteCompressedInParallel(dataSet.getDatasetPath(),
+                            dataSet.getDatasetId(), H5T_NATIVE_INT64, slabStartOrNull,
+                            blockDimensions, data, registry))
+                    {
+                        return null; // Nothing to return.
+                    }
                     final int dataSpaceId =
                             baseWriter.h5.getDataSpaceForDataSet(dataSet.getDatasetId(), registry);
                     baseWriter.h5.setHyperslabBlock(dataSpaceId, slabStartOrNull, blockDimensions);
@@ -391,6 +414,46 @@ class HDF5LongWriter extends HDF5LongReader implements IHDF5LongWriter
         baseWriter.runner.call(writeRunnable);
     }
 
+    @Override
+    public void writeFromBuffer(final String objectPath, final long offset,
+            final LongBuffer buffer)
+    {
+        assert objectPath != null;
+        assert buffer != null;
+
+        baseWriter.checkOpen();
+        final int dataSize = buffer.remaining();
+        if (dataSize == 0)
+        {
+            return;
+        }
+        final ICallableWithCleanUp<Void> writeRunnable = new ICallableWithCleanUp<Void>()
+            {
+                @Override
+                public Void call(ICleanUpRegistry registry)
+                {
+                    final long[] blockDimensions = new long[]
+                        { dataSize };
+                    final long[] slabStartOrNull = new long[]
+                        { offset };
+                    final int dataSetId =
+                            baseWriter.h5.openAndExtendDataSet(baseWriter.fileId, objectPath,
+                                    baseWriter.fileFormat, new long[]
+                                        { offset + dataSize }, -1, registry);
+                    final int dataSpaceId =
+                            baseWriter.h5.getDataSpaceForDataSet(dataSetId, registry);
+                    baseWriter.h5.setHyperslabBlock(dataSpaceId, slabStartOrNull, blockDimensions);
+                    final int memorySpaceId =
+                            baseWriter.h5.createSimpleDataSpace(blockDimensions, registry);
+                    baseWriter.h5.writeDataSet(dataSetId, H5T_NATIVE_INT64, memorySpaceId,
+                            dataSpaceId, buffer);
+                    return null; // Nothing to return.
+                }
+            };
+        baseWriter.runner.call(writeRunnable);
+        buffer.position(buffer.limit());
+    }
+
     /**
      * Writes out a <code>long</code> matrix (array of rank 2).
      * 
@@ -548,6 +611,12 @@ class HDF5LongWriter extends HDF5LongReader implements IHDF5LongWriter
                     final int dataSetId =
                             baseWriter.getOrCreateDataSetId(objectPath, features.isSigned() ? H5T_STD_I64LE : H5T_STD_U64LE, 
                                     data.longDimensions(), 8, features, registry);
+                    if (baseWriter.tryWriteCompressedInParallel(objectPath, dataSetId,
+                            H5T_NATIVE_INT64, null, data.longDimensions(), data.getAsFlatArray(),
+                            registry))
+                    {
+                        return null; // Nothing to return.
+                    }
                     H5Dwrite(dataSetId, H5T_NATIVE_INT64, H5S_ALL, H5S_ALL, H5P_DEFAULT, 
                             data.getAsFlatArray());
                     return null; // Nothing to return.
@@ -691,6 +760,11 @@ class HDF5LongWriter extends HDF5LongReader implements IHDF5LongWriter
                     final int dataSetId =
                             baseWriter.h5.openAndExtendDataSet(baseWriter.fileId, objectPath,
                                     baseWriter.fileFormat, dataSetDimensions, -1, registry);
+                    if (baseWriter.tryWriteCompressedInParallel(objectPath, dataSetId,
+                            H5T_NATIVE_INT64, offset, dimensions, data.getAsFlatArray(), registry))
+                    {
+                        return null; // Nothing to return.
+                    }
                     final int dataSpaceId = 
                             baseWriter.h5.getDataSpaceForDataSet(dataSetId, registry);
                     baseWriter.h5.setHyperslabBlock(dataSpaceId, offset, dimensions);
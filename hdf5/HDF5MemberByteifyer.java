@@ -95,6 +95,34 @@ abstract class HDF5MemberByteifyer
 
     abstract byte[] byteify(int compoundDataTypeId, Object obj) throws IllegalAccessException;
 
+    /**
+     * Writes the member of <var>obj</var> directly into the record buffer <var>byteArr</var>, at
+     * the record that starts at <var>arrayOffset</var>, without creating a temporary array.
+     * 
+     * @return <code>true</code>, if the member has been written, <code>false</code>, if this
+     *         byteifyer can't do it for <var>obj</var> and {@link #byteify(int, Object)} needs to
+     *         be used instead.
+     */
+    boolean byteifyInto(int compoundDataTypeId, Object obj, byte[] byteArr, int arrayOffset)
+            throws IllegalAccessException
+    {
+        return false;
+    }
+
+    /**
+     * Writes the variable-length member of <var>obj</var> into the record buffer
+     * <var>byteArr</var>, at the record that starts at <var>arrayOffset</var>, taking the native
+     * memory from <var>arena</var>.
+     * 
+     * @return <code>true</code>, if the member has been written, <code>false</code>, if this
+     *         byteifyer is not for a variable-length member that can be stored in an arena.
+     */
+    boolean byteifyInto(Object obj, byte[] byteArr, int arrayOffset, HDF5VLStringArena arena)
+            throws IllegalAccessException
+    {
+        return false;
+    }
+
     abstract void setFromByteArray(int compoundDataTypeId, Object obj, byte[] byteArr,
             int arrayOffset) throws IllegalAccessException;
 
@@ -167,6 +195,11 @@ abstract class HDF5MemberByteifyer
         return offsetInMemory + size;
     }
 
+    CharacterEncoding getCharacterEncoding()
+    {
+        return encoding;
+    }
+
     HDF5DataTypeVariant getTypeVariant()
     {
         return typeVariant;
@@ -194,6 +227,14 @@ abstract class HDF5MemberByteifyer
         return false;
     }
 
+    /**
+     * Returns <code>true</code>, if this member is stored as a fixed or variable-length string.
+     */
+    boolean isString()
+    {
+        return false;
+    }
+
     boolean mayBeCut()
     {
         return false;
@@ -114,6 +114,13 @@ class HDF5ObjectReadOnlyInfoProviderHandler implements IHDF5ObjectReadOnlyInfoPr
         return baseReader.openDataSet(objectPath);
     }
 
+    @Override
+    public HDF5DataSet openDataSet(final String objectPath, HDF5ChunkCacheParameters chunkCache)
+    {
+        baseReader.checkOpen();
+        return baseReader.openDataSet(objectPath, chunkCache);
+    }
+
     @Override
     public String toHouseKeepingPath(String objectPath)
     {
@@ -18,6 +18,9 @@ package ch.systemsx.cisd.hdf5;
 
 import static ch.systemsx.cisd.hdf5.HDF5Utils.createAttributeTypeVariantAttributeName;
 import static ch.systemsx.cisd.hdf5.HDF5Utils.createObjectTypeVariantAttributeName;
+import static ch.systemsx.cisd.hdf5.HDF5Utils.getStringDictionaryPath;
+
+import ncsa.hdf.hdf5lib.exceptions.HDF5JavaException;
 
 import ch.systemsx.cisd.hdf5.cleanup.ICallableWithCleanUp;
 import ch.systemsx.cisd.hdf5.cleanup.ICleanUpRegistry;
@@ -123,14 +126,35 @@ final class HDF5ObjectReadWriteInfoProviderHandler extends HDF5ObjectReadOnlyInf
                 delete(path);
             }
         }
-        baseWriter.h5.deleteObject(baseWriter.fileId, objectPath);
+        baseWriter.deleteObjectAndDictionary(objectPath);
     }
 
     @Override
     public void move(String oldLinkPath, String newLinkPath)
     {
         baseWriter.checkOpen();
+        final String dictionaryPathOrNull = baseWriter.tryGetOwnStringDictionaryPath(oldLinkPath);
+        final String newDictionaryPath =
+                getStringDictionaryPath(newLinkPath, baseWriter.houseKeepingNameSuffix);
+        boolean moveDictionary = false;
+        if (dictionaryPathOrNull != null)
+        {
+            // Checked before moving anything, so that a failure doesn't separate the two.
+            moveDictionary = (exists(newDictionaryPath, false) == false);
+            if (moveDictionary == false
+                    && baseWriter.hasStringDictionaryReference(oldLinkPath) == false)
+            {
+                throw new HDF5JavaException("Cannot move dictionary " + dictionaryPathOrNull
+                        + " of " + oldLinkPath + " as " + newDictionaryPath
+                        + " already exists.");
+            }
+        }
         baseWriter.h5.moveLink(baseWriter.fileId, oldLinkPath, newLinkPath);
+        // Otherwise the dictionary stays where it is and is found by its reference.
+        if (moveDictionary)
+        {
+            baseWriter.h5.moveLink(baseWriter.fileId, dictionaryPathOrNull, newDictionaryPath);
+        }
     }
 
     // /////////////////////
@@ -232,6 +256,35 @@ final class HDF5ObjectReadWriteInfoProviderHandler extends HDF5ObjectReadOnlyInf
         baseWriter.runner.call(writeRunnable);
     }
 
+    @Override
+    public void writeChunkRaw(final HDF5DataSet dataSet, final long[] chunkOffset,
+            final int filterMask, final byte[] chunkBytes) throws HDF5JavaException
+    {
+        assert dataSet != null;
+        assert chunkOffset != null;
+        assert chunkBytes != null;
+
+        baseWriter.checkOpen();
+        if (dataSet.getLayout() != HDF5StorageLayout.CHUNKED)
+        {
+            throw new HDF5JavaException("Data set '" + dataSet.getDatasetPath()
+                    + "' is not chunked.");
+        }
+        if (chunkOffset.length != dataSet.getDimensions().length)
+        {
+            throw new HDF5JavaException("Chunk offset has rank " + chunkOffset.length
+                    + ", but data set '" + dataSet.getDatasetPath() + "' has rank "
+                    + dataSet.getDimensions().length + ".");
+        }
+        baseWriter.h5.writeChunkRaw(dataSet.getDatasetId(), chunkOffset, filterMask, chunkBytes);
+    }
+
+    @Override
+    public boolean isWriteChunkRawSupported()
+    {
+        return baseWriter.h5.isWriteChunkRawSupported();
+    }
+
     // /////////////////////
     // Types
     // /////////////////////
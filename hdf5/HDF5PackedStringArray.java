@@ -0,0 +1,295 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5;
+
+import java.util.HashMap;
+import java.util.Map;
+
+/**
+ * A packed array of fixed-length strings as they are stored in an HDF5 data set.
+ * <p>
+ * The elements are kept in one <code>byte[]</code>, element <var>i</var> starting at
+ * <code>i * getStride()</code>. The length of an element is the number of bytes before the first
+ * '\0', or the stride if the element has no '\0'. No <code>String</code> is created when the array
+ * is read; an element is only decoded by {@link #getString(int)}, {@link #toStringArray()} or
+ * {@link #toStringArray(boolean)}. For ASCII strings, {@link #getCharSequence(int)} gives a view on
+ * an element without decoding it.
+ * <p>
+ * For columns with few distinct values, {@link #toStringArray(boolean)} with
+ * <code>deduplicate=true</code> decodes every distinct value only once and returns the same
+ * <code>String</code> object for equal elements.
+ *
+ * @author Bernd Rinn
+ */
+public final class HDF5PackedStringArray
+{
+
+    private final byte[] bytes;
+
+    private final int stride;
+
+    private final int[] lengths;
+
+    private final CharacterEncoding encoding;
+
+    HDF5PackedStringArray(byte[] bytes, int stride, int size, CharacterEncoding encoding)
+    {
+        this.bytes = bytes;
+        this.stride = stride;
+        this.lengths = new int[size];
+        this.encoding = encoding;
+        for (int i = 0, startIdx = 0; i < size; ++i, startIdx += stride)
+        {
+            int termIdx = startIdx;
+            final int endIdx = startIdx + stride;
+            while (termIdx < endIdx && bytes[termIdx] != 0)
+            {
+                ++termIdx;
+            }
+            lengths[i] = termIdx - startIdx;
+        }
+    }
+
+    /**
+     * Returns the number of elements.
+     */
+    public int size()
+    {
+        return lengths.length;
+    }
+
+    /**
+     * Returns the bytes of all elements. This is the internal array, not a copy.
+     */
+    public byte[] getBytes()
+    {
+        return bytes;
+    }
+
+    /**
+     * Returns the number of bytes reserved for each element, i.e. the fixed string length of the
+     * data set.
+     */
+    public int getStride()
+    {
+        return stride;
+    }
+
+    /**
+     * Returns the offset of element <var>index</var> in {@link #getBytes()}.
+     */
+    public int getOffset(int index)
+    {
+        checkIndex(index);
+        return index * stride;
+    }
+
+    /**
+     * Returns the length of element <var>index</var> in bytes, not counting the terminating '\0'.
+     */
+    public int getLength(int index)
+    {
+        checkIndex(index);
+        return lengths[index];
+    }
+
+    /**
+     * Returns the character encoding of the elements.
+     */
+    public CharacterEncoding getEncoding()
+    {
+        return encoding;
+    }
+
+    /**
+     * Returns element <var>index</var> as a {@link CharSequence}. For ASCII strings this is a view
+     * on {@link #getBytes()} that does not decode or copy the element; for other encodings the
+     * element is decoded.
+     */
+    public CharSequence getCharSequence(int index)
+    {
+        checkIndex(index);
+        if (encoding == CharacterEncoding.ASCII)
+        {
+            return new AsciiCharSequence(index * stride, lengths[index]);
+        }
+        return getString(index);
+    }
+
+    /**
+     * Decodes element <var>index</var> into a new <code>String</code>.
+     */
+    public String getString(int index)
+    {
+        checkIndex(index);
+        final int startIdx = index * stride;
+        return StringUtils.fromBytes(bytes, startIdx, startIdx + lengths[index], encoding);
+    }
+
+    /**
+     * Decodes all elements into a new <code>String</code> each.
+     */
+    public String[] toStringArray()
+    {
+        return toStringArray(false);
+    }
+
+    /**
+     * Decodes all elements.
+     *
+     * @param deduplicate If <code>true</code>, every distinct element is decoded only once and
+     *            equal elements share the same <code>String</code> object. This pays off for
+     *            columns with few distinct values.
+     */
+    public String[] toStringArray(boolean deduplicate)
+    {
+        final String[] result = new String[lengths.length];
+        if (deduplicate == false)
+        {
+            for (int i = 0; i < result.length; ++i)
+            {
+                result[i] = getString(i);
+            }
+            return result;
+        }
+        final Map<ByteRange, String> distinct = new HashMap<ByteRange, String>();
+        for (int i = 0; i < result.length; ++i)
+        {
+            final ByteRange key = new ByteRange(i * stride, lengths[i]);
+            String s = distinct.get(key);
+            if (s == null)
+            {
+                s = getString(i);
+                distinct.put(key, s);
+            }
+            result[i] = s;
+        }
+        return result;
+    }
+
+    private void checkIndex(int index)
+    {
+        if (index < 0 || index >= lengths.length)
+        {
+            throw new IndexOutOfBoundsException("Index " + index + " out of bounds [0, "
+                    + lengths.length + ").");
+        }
+    }
+
+    /**
+     * A range of {@link HDF5PackedStringArray#bytes} that compares by content.
+     */
+    private final class ByteRange
+    {
+        private final int offset;
+
+        private final int length;
+
+        private final int hashCode;
+
+        ByteRange(int offset, int length)
+        {
+            this.offset = offset;
+            this.length = length;
+            int h = 1;
+            for (int i = offset; i < offset + length; ++i)
+            {
+                h = 31 * h + bytes[i];
+            }
+            this.hashCode = h;
+        }
+
+        @Override
+        public int hashCode()
+        {
+            return hashCode;
+        }
+
+        @Override
+        public boolean equals(Object obj)
+        {
+            if (obj instanceof ByteRange == false)
+            {
+                return false;
+            }
+            final ByteRange that = (ByteRange) obj;
+            if (length != that.length || hashCode != that.hashCode)
+            {
+                return false;
+            }
+            for (int i = 0; i < length; ++i)
+            {
+                if (bytes[offset + i] != bytes[that.offset + i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    /**
+     * A view on an ASCII element of {@link HDF5PackedStringArray#bytes}.
+     */
+    private final class AsciiCharSequence implements CharSequence
+    {
+        private final int offset;
+
+        private final int length;
+
+        AsciiCharSequence(int offset, int length)
+        {
+            this.offset = offset;
+            this.length = length;
+        }
+
+        @Override
+        public int length()
+        {
+            return length;
+        }
+
+        @Override
+        public char charAt(int index)
+        {
+            if (index < 0 || index >= length)
+            {
+                throw new IndexOutOfBoundsException("Index " + index + " out of bounds [0, "
+                        + length + ").");
+            }
+            return (char) (bytes[offset + index] & 0xff);
+        }
+
+        @Override
+        public CharSequence subSequence(int start, int end)
+        {
+            if (start < 0 || end > length || start > end)
+            {
+                throw new IndexOutOfBoundsException("Range [" + start + ", " + end
+                        + ") out of bounds [0, " + length + ").");
+            }
+            return new AsciiCharSequence(offset + start, end - start);
+        }
+
+        @Override
+        public String toString()
+        {
+            return StringUtils.fromBytes(bytes, offset, offset + length, encoding);
+        }
+    }
+
+}
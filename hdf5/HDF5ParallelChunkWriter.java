@@ -0,0 +1,563 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5;
+
+import static ch.systemsx.cisd.hdf5.hdf5lib.H5D.H5Dget_create_plist;
+import static ch.systemsx.cisd.hdf5.hdf5lib.H5D.H5Dget_type;
+import static ch.systemsx.cisd.hdf5.hdf5lib.H5P.H5Pclose;
+import static ch.systemsx.cisd.hdf5.hdf5lib.H5P.H5Pget_chunk;
+import static ch.systemsx.cisd.hdf5.hdf5lib.H5P.H5Pget_filter;
+import static ch.systemsx.cisd.hdf5.hdf5lib.H5P.H5Pget_layout;
+import static ch.systemsx.cisd.hdf5.hdf5lib.H5P.H5Pget_nfilters;
+import static ch.systemsx.cisd.hdf5.hdf5lib.H5T.H5Tclose;
+import static ch.systemsx.cisd.hdf5.hdf5lib.H5T.H5Tequal;
+import static ch.systemsx.cisd.hdf5.hdf5lib.H5T.H5Tget_size;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5D_CHUNKED;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5S_MAX_RANK;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5Z_FILTER_DEFLATE;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5Z_FILTER_SHUFFLE;
+
+import java.util.ArrayDeque;
+import java.util.Arrays;
+import java.util.LinkedHashMap;
+import java.util.Map;
+import java.util.Queue;
+import java.util.concurrent.Callable;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Future;
+import java.util.zip.Deflater;
+
+import ch.systemsx.cisd.base.exceptions.CheckedExceptionTunnel;
+import ch.systemsx.cisd.base.namedthread.NamingThreadPoolExecutor;
+import ch.systemsx.cisd.hdf5.cleanup.ICleanUpRegistry;
+import ch.systemsx.cisd.hdf5.hdf5lib.HDFNativeData;
+
+/**
+ * Writes blocks of chunked data sets by shuffling and deflating the chunks on a thread pool and
+ * committing them in order as raw chunks, bypassing the (single-threaded) filter pipeline of the
+ * library.
+ * <p>
+ * The encoding reproduces the shuffle and deflate filters of the library: a chunk that is only
+ * partially covered by the data set is padded with the fill value 0, the shuffle filter is skipped
+ * for elements of size 1 and a chunk that does not get smaller by deflating is stored without it,
+ * with the bit of the deflate filter set in the filter mask, as the library does for the optional
+ * deflate filter. Provided that the zlib that the JRE links against is the same as the one of the
+ * HDF5 library, the chunks are byte-identical to what the filter pipeline would have written.
+ * Chunks that are too large for a Java array are not encoded here. Blocks that don't qualify are
+ * left to the caller, see
+ * {@link #tryWrite(HDF5, String, int, int, long[], long[], Object, ICleanUpRegistry)}.
+ *
+ * @author Bernd Rinn
+ */
+final class HDF5ParallelChunkWriter
+{
+
+    private final ExecutorService compressionExecutor;
+
+    private final int maxChunksInFlight;
+
+    /** The maximal number of data sets whose chunk encoding is kept. */
+    private static final int ENCODING_CACHE_CAPACITY = 64;
+
+    /** The maximal length of an array that all JVMs can allocate. */
+    private static final long MAX_ARRAY_LENGTH = Integer.MAX_VALUE - 8;
+
+    /**
+     * The chunk encodings of the data sets written to, keyed by data set path. Cleared whenever
+     * links of the file are deleted or moved.
+     */
+    private final Map<String, CachedChunkEncoding> encodings;
+
+    /**
+     * The parts of the filter pipeline of a data set that this class knows how to reproduce.
+     */
+    private static final class ChunkEncoding
+    {
+        final long[] chunkDimensions;
+
+        final int elementSize;
+
+        final boolean shuffle;
+
+        final int deflateLevel;
+
+        /** The filter mask of a chunk that is stored without deflating it. */
+        final int notDeflatedFilterMask;
+
+        ChunkEncoding(long[] chunkDimensions, int elementSize, boolean shuffle, int deflateLevel,
+                int deflateFilterIndex)
+        {
+            this.chunkDimensions = chunkDimensions;
+            this.elementSize = elementSize;
+            this.shuffle = shuffle;
+            this.deflateLevel = deflateLevel;
+            this.notDeflatedFilterMask = 1 << deflateFilterIndex;
+        }
+    }
+
+    /**
+     * The chunk encoding of a data set for one memory type, <code>null</code> if this class can't
+     * reproduce it.
+     */
+    private static final class CachedChunkEncoding
+    {
+        final int memoryTypeId;
+
+        final ChunkEncoding encodingOrNull;
+
+        CachedChunkEncoding(int memoryTypeId, ChunkEncoding encodingOrNull)
+        {
+            this.memoryTypeId = memoryTypeId;
+            this.encodingOrNull = encodingOrNull;
+        }
+    }
+
+    /**
+     * An encoded chunk, ready to be written.
+     */
+    private static final class EncodedChunk
+    {
+        final long[] offset;
+
+        final int filterMask;
+
+        final byte[] bytes;
+
+        EncodedChunk(long[] offset, int filterMask, byte[] bytes)
+        {
+            this.offset = offset;
+            this.filterMask = filterMask;
+            this.bytes = bytes;
+        }
+    }
+
+    /**
+     * Creates a writer that compresses on <var>numberOfThreads</var> threads. The number of threads
+     * has been validated by the configurator.
+     */
+    HDF5ParallelChunkWriter(int numberOfThreads)
+    {
+        assert numberOfThreads >= 1;
+
+        this.compressionExecutor =
+                new NamingThreadPoolExecutor("HDF5 Compress").corePoolSize(numberOfThreads)
+                        .daemonize();
+        this.maxChunksInFlight = 2 * numberOfThreads;
+        this.encodings = new LinkedHashMap<String, CachedChunkEncoding>(16, 0.75f, true)
+            {
+                private static final long serialVersionUID = 1L;
+
+                @Override
+                protected boolean removeEldestEntry(Map.Entry<String, CachedChunkEncoding> eldest)
+                {
+                    return size() > ENCODING_CACHE_CAPACITY;
+                }
+            };
+    }
+
+    /**
+     * Writes the block <var>flatData</var> of dimensions <var>blockDimensions</var> at
+     * <var>blockOffsetOrNull</var> (<code>null</code> meaning the origin) of the data set
+     * <var>dataSetId</var> at <var>objectPath</var>, if this can be done chunk by chunk.
+     * <p>
+     * This is the case if the data set is chunked, its filter pipeline consists of deflate,
+     * optionally preceded by shuffle, its data type is equal to <var>memoryTypeId</var> and the
+     * block is aligned to the chunk grid (apart from the edge of the data set). It also needs a
+     * native library that can write raw chunks.
+     *
+     * @return <code>true</code>, if the block has been written, <code>false</code>, if the caller
+     *         needs to write it by means of <code>H5Dwrite</code>.
+     */
+    boolean tryWrite(HDF5 h5, String objectPath, int dataSetId, int memoryTypeId,
+            long[] blockOffsetOrNull, long[] blockDimensions, Object flatData,
+            ICleanUpRegistry registry)
+    {
+        if (h5.isWriteChunkRawSupported() == false)
+        {
+            return false;
+        }
+        final ChunkEncoding encodingOrNull =
+                tryGetChunkEncoding(objectPath, dataSetId, memoryTypeId);
+        if (encodingOrNull == null)
+        {
+            return false;
+        }
+        final long[] blockOffset =
+                (blockOffsetOrNull != null) ? blockOffsetOrNull : new long[blockDimensions.length];
+        if (isChunkAligned(blockOffset, blockDimensions, encodingOrNull.chunkDimensions,
+                h5.getDataDimensions(dataSetId, registry)) == false)
+        {
+            return false;
+        }
+        writeChunks(h5, dataSetId, encodingOrNull, blockOffset, blockDimensions,
+                toNativeBytes(flatData));
+        return true;
+    }
+
+    /**
+     * Forgets the chunk encodings of all data sets. Needs to be called whenever links of the file
+     * are deleted or moved.
+     */
+    synchronized void clearEncodings()
+    {
+        encodings.clear();
+    }
+
+    /**
+     * Stops the compression threads.
+     */
+    void shutdown()
+    {
+        compressionExecutor.shutdown();
+    }
+
+    private void writeChunks(HDF5 h5, int dataSetId, final ChunkEncoding encoding,
+            final long[] blockOffset, final long[] blockDimensions, final byte[] data)
+    {
+        final int rank = blockDimensions.length;
+        final long[] chunkDimensions = encoding.chunkDimensions;
+        final Queue<Future<EncodedChunk>> pendingChunks = new ArrayDeque<Future<EncodedChunk>>();
+        final long[] chunkOffsetInBlock = new long[rank];
+        boolean moreChunks = true;
+        try
+        {
+            while (moreChunks || pendingChunks.isEmpty() == false)
+            {
+                while (moreChunks && pendingChunks.size() < maxChunksInFlight)
+                {
+                    final long[] offsetInBlock = chunkOffsetInBlock.clone();
+                    pendingChunks.add(compressionExecutor.submit(new Callable<EncodedChunk>()
+                        {
+                            @Override
+                            public EncodedChunk call() throws Exception
+                            {
+                                return encodeChunk(encoding, data, blockOffset, blockDimensions,
+                                        offsetInBlock);
+                            }
+                        }));
+                    moreChunks = nextChunk(chunkOffsetInBlock, chunkDimensions, blockDimensions);
+                }
+                final EncodedChunk chunk = pendingChunks.poll().get();
+                h5.writeChunkRaw(dataSetId, chunk.offset, chunk.filterMask, chunk.bytes);
+            }
+        } catch (ExecutionException ex)
+        {
+            throw CheckedExceptionTunnel.wrapIfNecessary(ex.getCause());
+        } catch (InterruptedException ex)
+        {
+            Thread.currentThread().interrupt();
+            throw CheckedExceptionTunnel.wrapIfNecessary(ex);
+        } finally
+        {
+            for (Future<EncodedChunk> pendingChunk : pendingChunks)
+            {
+                pendingChunk.cancel(false);
+            }
+        }
+    }
+
+    /**
+     * Advances <var>chunkOffsetInBlock</var> to the next chunk of the block in row-major order.
+     *
+     * @return <code>false</code>, if there is no next chunk.
+     */
+    private static boolean nextChunk(long[] chunkOffsetInBlock, long[] chunkDimensions,
+            long[] blockDimensions)
+    {
+        for (int d = chunkOffsetInBlock.length - 1; d >= 0; --d)
+        {
+            chunkOffsetInBlock[d] += chunkDimensions[d];
+            if (chunkOffsetInBlock[d] < blockDimensions[d])
+            {
+                return true;
+            }
+            chunkOffsetInBlock[d] = 0;
+        }
+        return false;
+    }
+
+    private static EncodedChunk encodeChunk(ChunkEncoding encoding, byte[] data,
+            long[] blockOffset, long[] blockDimensions, long[] chunkOffsetInBlock)
+    {
+        final int rank = blockDimensions.length;
+        final long[] chunkOffset = new long[rank];
+        for (int d = 0; d < rank; ++d)
+        {
+            chunkOffset[d] = blockOffset[d] + chunkOffsetInBlock[d];
+        }
+        byte[] bytes =
+                extractChunk(data, blockDimensions, encoding.chunkDimensions,
+                        chunkOffsetInBlock, encoding.elementSize);
+        if (encoding.shuffle)
+        {
+            bytes = shuffle(bytes, encoding.elementSize);
+        }
+        final byte[] deflatedBytes = deflate(bytes, encoding.deflateLevel);
+        if (deflatedBytes.length >= bytes.length)
+        {
+            // The deflate filter is optional, the library skips it if it does not pay off.
+            return new EncodedChunk(chunkOffset, encoding.notDeflatedFilterMask, bytes);
+        }
+        // The filter mask is 0 as all filters have been applied.
+        return new EncodedChunk(chunkOffset, 0, deflatedBytes);
+    }
+
+    /**
+     * Copies the chunk at <var>chunkOffsetInBlock</var> out of the row-major block
+     * <var>data</var>. The part of the chunk that lies outside of the block is left 0.
+     */
+    private static byte[] extractChunk(byte[] data, long[] blockDimensions,
+            long[] chunkDimensions, long[] chunkOffsetInBlock, int elementSize)
+    {
+        final int rank = blockDimensions.length;
+        final long[] extent = new long[rank];
+        long chunkLength = elementSize;
+        for (int d = 0; d < rank; ++d)
+        {
+            extent[d] =
+                    Math.min(chunkDimensions[d], blockDimensions[d] - chunkOffsetInBlock[d]);
+            chunkLength *= chunkDimensions[d];
+        }
+        final byte[] chunk = new byte[(int) chunkLength];
+        final int rowLength = (int) extent[rank - 1] * elementSize;
+        final long[] indexInChunk = new long[rank];
+        int d;
+        do
+        {
+            long indexInBlock = 0;
+            long index = 0;
+            for (int i = 0; i < rank; ++i)
+            {
+                indexInBlock =
+                        indexInBlock * blockDimensions[i] + chunkOffsetInBlock[i]
+                                + indexInChunk[i];
+                index = index * chunkDimensions[i] + indexInChunk[i];
+            }
+            System.arraycopy(data, (int) (indexInBlock * elementSize), chunk,
+                    (int) (index * elementSize), rowLength);
+            for (d = rank - 2; d >= 0 && ++indexInChunk[d] == extent[d]; --d)
+            {
+                indexInChunk[d] = 0;
+            }
+        } while (d >= 0);
+        return chunk;
+    }
+
+    /**
+     * Does what the shuffle filter of the library does: stores the first bytes of all elements,
+     * then the second bytes of all elements and so on. Trailing bytes that don't make up a full
+     * element are kept as they are.
+     */
+    private static byte[] shuffle(byte[] bytes, int elementSize)
+    {
+        final int numberOfElements = bytes.length / elementSize;
+        if (elementSize <= 1 || numberOfElements <= 1)
+        {
+            return bytes;
+        }
+        final byte[] shuffled = new byte[bytes.length];
+        for (int j = 0; j < elementSize; ++j)
+        {
+            final int shuffledOffset = j * numberOfElements;
+            for (int i = 0; i < numberOfElements; ++i)
+            {
+                shuffled[shuffledOffset + i] = bytes[i * elementSize + j];
+            }
+        }
+        final int shuffledLength = numberOfElements * elementSize;
+        System.arraycopy(bytes, shuffledLength, shuffled, shuffledLength, bytes.length
+                - shuffledLength);
+        return shuffled;
+    }
+
+    /**
+     * Does what the deflate filter of the library does: compresses <var>bytes</var> in zlib format
+     * into a buffer of size <code>compressBound()</code>, which always fits.
+     */
+    private static byte[] deflate(byte[] bytes, int deflateLevel)
+    {
+        final Deflater deflater = new Deflater(deflateLevel);
+        try
+        {
+            deflater.setInput(bytes);
+            deflater.finish();
+            final byte[] buffer = new byte[(int) compressBound(bytes.length)];
+            int length = 0;
+            while (deflater.finished() == false)
+            {
+                length += deflater.deflate(buffer, length, buffer.length - length);
+            }
+            return Arrays.copyOf(buffer, length);
+        } finally
+        {
+            deflater.end();
+        }
+    }
+
+    /**
+     * Returns the upper bound of the size of <var>length</var> bytes compressed by zlib, as
+     * <code>compressBound()</code> of zlib computes it.
+     */
+    private static long compressBound(long length)
+    {
+        return length + (length >> 12) + (length >> 14) + (length >> 25) + 13;
+    }
+
+    private static boolean isChunkAligned(long[] blockOffset, long[] blockDimensions,
+            long[] chunkDimensions, long[] dataSetDimensions)
+    {
+        if (blockOffset.length != chunkDimensions.length
+                || blockDimensions.length != chunkDimensions.length)
+        {
+            return false;
+        }
+        for (int d = 0; d < chunkDimensions.length; ++d)
+        {
+            if (blockDimensions[d] == 0 || blockOffset[d] % chunkDimensions[d] != 0)
+            {
+                return false;
+            }
+            if (blockDimensions[d] % chunkDimensions[d] != 0
+                    && blockOffset[d] + blockDimensions[d] != dataSetDimensions[d])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Returns the encoding of the chunks of the data set <var>objectPath</var> for
+     * <var>memoryTypeId</var>, or <code>null</code>, if this class can't reproduce it. Only the
+     * first write to a data set queries its type and filter pipeline.
+     */
+    private synchronized ChunkEncoding tryGetChunkEncoding(String objectPath, int dataSetId,
+            int memoryTypeId)
+    {
+        final CachedChunkEncoding cachedOrNull = encodings.get(objectPath);
+        if (cachedOrNull != null && cachedOrNull.memoryTypeId == memoryTypeId)
+        {
+            return cachedOrNull.encodingOrNull;
+        }
+        final ChunkEncoding encodingOrNull = tryQueryChunkEncoding(dataSetId, memoryTypeId);
+        encodings.put(objectPath, new CachedChunkEncoding(memoryTypeId, encodingOrNull));
+        return encodingOrNull;
+    }
+
+    private static ChunkEncoding tryQueryChunkEncoding(int dataSetId, int memoryTypeId)
+    {
+        final int dataTypeId = H5Dget_type(dataSetId);
+        try
+        {
+            if (H5Tequal(dataTypeId, memoryTypeId) == false)
+            {
+                return null;
+            }
+        } finally
+        {
+            H5Tclose(dataTypeId);
+        }
+        final int elementSize = H5Tget_size(memoryTypeId);
+        final int creationPropertyListId = H5Dget_create_plist(dataSetId);
+        try
+        {
+            if (H5Pget_layout(creationPropertyListId) != H5D_CHUNKED)
+            {
+                return null;
+            }
+            final int numberOfFilters = H5Pget_nfilters(creationPropertyListId);
+            boolean shuffle = false;
+            int deflateLevel = -1;
+            int deflateFilterIndex = -1;
+            for (int i = 0; i < numberOfFilters; ++i)
+            {
+                final int[] flags = new int[1];
+                final int[] cdValues = new int[4];
+                final int[] numberOfCdValues = new int[]
+                    { cdValues.length };
+                final String[] name = new String[1];
+                final int filter =
+                        H5Pget_filter(creationPropertyListId, i, flags, numberOfCdValues,
+                                cdValues, 64, name);
+                if (filter == H5Z_FILTER_SHUFFLE && deflateLevel < 0)
+                {
+                    shuffle = true;
+                } else if (filter == H5Z_FILTER_DEFLATE && deflateLevel < 0)
+                {
+                    deflateLevel = cdValues[0];
+                    deflateFilterIndex = i;
+                } else
+                {
+                    return null;
+                }
+            }
+            if (deflateLevel < 0)
+            {
+                // Nothing worth compressing in parallel.
+                return null;
+            }
+            final long[] maxChunkDimensions = new long[H5S_MAX_RANK];
+            final int rank =
+                    H5Pget_chunk(creationPropertyListId, H5S_MAX_RANK, maxChunkDimensions);
+            final long[] chunkDimensions = Arrays.copyOf(maxChunkDimensions, rank);
+            long chunkLength = elementSize;
+            for (long chunkDimension : chunkDimensions)
+            {
+                chunkLength *= chunkDimension;
+                if (compressBound(chunkLength) > MAX_ARRAY_LENGTH)
+                {
+                    // The chunk does not fit into a Java array.
+                    return null;
+                }
+            }
+            return new ChunkEncoding(chunkDimensions, elementSize, shuffle, deflateLevel,
+                    deflateFilterIndex);
+        } finally
+        {
+            H5Pclose(creationPropertyListId);
+        }
+    }
+
+    private static byte[] toNativeBytes(Object flatData)
+    {
+        if (flatData instanceof byte[])
+        {
+            return (byte[]) flatData;
+        } else if (flatData instanceof short[])
+        {
+            return HDFNativeData.shortToByte((short[]) flatData);
+        } else if (flatData instanceof int[])
+        {
+            return HDFNativeData.intToByte((int[]) flatData);
+        } else if (flatData instanceof long[])
+        {
+            return HDFNativeData.longToByte((long[]) flatData);
+        } else if (flatData instanceof float[])
+        {
+            return HDFNativeData.floatToByte((float[]) flatData);
+        } else if (flatData instanceof double[])
+        {
+            return HDFNativeData.doubleToByte((double[]) flatData);
+        } else
+        {
+            throw new IllegalArgumentException("Unsupported data type: "
+                    + flatData.getClass().getSimpleName());
+        }
+    }
+
+}
@@ -0,0 +1,251 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5;
+
+import java.io.Closeable;
+import java.util.ArrayDeque;
+import java.util.Iterator;
+import java.util.NoSuchElementException;
+import java.util.Queue;
+import java.util.concurrent.Callable;
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.ConcurrentLinkedQueue;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Future;
+
+import ch.systemsx.cisd.base.exceptions.CheckedExceptionTunnel;
+import ch.systemsx.cisd.base.namedthread.NamingThreadPoolExecutor;
+
+/**
+ * An iterator over data blocks that reads the next blocks in the background while the caller
+ * processes the current block.
+ * <p>
+ * At most <var>numberOfBlocksToPrefetch</var> blocks are read ahead. A block that has been
+ * returned by {@link #next()} is recycled on the next call of {@link #next()}, so the caller must
+ * not keep references to it beyond that point. Together this caps the memory at about
+ * <code>numberOfBlocksToPrefetch + 2</code> blocks.
+ * <p>
+ * The source is closed when the last block has been returned, when a read fails, or when the
+ * iterator is closed before that with {@link #close()}, which cancels the reads that have not
+ * started yet.
+ *
+ * @author Bernd Rinn
+ */
+final class HDF5PrefetchingIterator<B> implements Iterator<B>, Closeable
+{
+
+    private final static ExecutorService prefetchExecutor = new NamingThreadPoolExecutor(
+            "HDF5 Prefetch").corePoolSize(3).daemonize();
+
+    /**
+     * A source of block read tasks. Its methods are only called from the thread that iterates.
+     */
+    interface IBlockSource<B>
+    {
+        /**
+         * Returns <code>true</code>, if there are more blocks to read.
+         */
+        boolean hasNext();
+
+        /**
+         * Advances to the next block and returns a task that reads it.
+         */
+        IBlockReadTask<B> nextTask();
+
+        /**
+         * Releases the resources of the source. Called once, after all reads have finished.
+         */
+        void close();
+    }
+
+    /**
+     * A task that reads one block. Called from a background thread.
+     */
+    interface IBlockReadTask<B>
+    {
+        /**
+         * Reads the block, re-using the storage of <var>recycledBlockOrNull</var> if it fits.
+         */
+        B read(B recycledBlockOrNull);
+    }
+
+    private final HDF5BaseReader baseReader;
+
+    private final IBlockSource<B> source;
+
+    private final Queue<Future<B>> pendingBlocks = new ArrayDeque<Future<B>>();
+
+    private final Queue<B> recycledBlocks = new ConcurrentLinkedQueue<B>();
+
+    private B currentBlockOrNull;
+
+    private boolean closed;
+
+    HDF5PrefetchingIterator(HDF5BaseReader baseReader, IBlockSource<B> source,
+            int numberOfBlocksToPrefetch)
+    {
+        if (numberOfBlocksToPrefetch < 1)
+        {
+            throw new IllegalArgumentException(
+                    "Number of blocks to prefetch needs to be >= 1, found: "
+                            + numberOfBlocksToPrefetch);
+        }
+        this.baseReader = baseReader;
+        this.source = source;
+        for (int i = 0; i < numberOfBlocksToPrefetch; ++i)
+        {
+            scheduleNext();
+        }
+        if (pendingBlocks.isEmpty())
+        {
+            close();
+        }
+    }
+
+    private void scheduleNext()
+    {
+        if (closed || source.hasNext() == false)
+        {
+            return;
+        }
+        final IBlockReadTask<B> task = source.nextTask();
+        pendingBlocks.add(prefetchExecutor.submit(new Callable<B>()
+            {
+                @Override
+                public B call() throws Exception
+                {
+                    // The reader may have been closed since the read has been scheduled.
+                    baseReader.checkOpen();
+                    return task.read(recycledBlocks.poll());
+                }
+            }));
+    }
+
+    @Override
+    public boolean hasNext()
+    {
+        return pendingBlocks.isEmpty() == false;
+    }
+
+    @Override
+    public B next()
+    {
+        final Future<B> nextBlock = pendingBlocks.poll();
+        if (nextBlock == null)
+        {
+            throw new NoSuchElementException();
+        }
+        if (currentBlockOrNull != null)
+        {
+            recycledBlocks.add(currentBlockOrNull);
+            currentBlockOrNull = null;
+        }
+        scheduleNext();
+        try
+        {
+            currentBlockOrNull = nextBlock.get();
+        } catch (ExecutionException ex)
+        {
+            close();
+            throw CheckedExceptionTunnel.wrapIfNecessary(ex.getCause());
+        } catch (InterruptedException ex)
+        {
+            Thread.currentThread().interrupt();
+            close();
+            throw CheckedExceptionTunnel.wrapIfNecessary(ex);
+        }
+        if (pendingBlocks.isEmpty())
+        {
+            // All reads are done.
+            close();
+        }
+        return currentBlockOrNull;
+    }
+
+    @Override
+    public void remove()
+    {
+        throw new UnsupportedOperationException();
+    }
+
+    /**
+     * Stops reading ahead: cancels the reads that have not started yet, waits for the ones that
+     * are running and closes the source. Blocks that have not been returned by {@link #next()}
+     * yet are dropped. Needs to be called if the iteration is abandoned before its end.
+     */
+    @Override
+    public void close()
+    {
+        if (closed)
+        {
+            return;
+        }
+        closed = true;
+        for (Future<B> pendingBlock : pendingBlocks)
+        {
+            pendingBlock.cancel(false);
+        }
+        try
+        {
+            for (Future<B> pendingBlock : pendingBlocks)
+            {
+                awaitQuietly(pendingBlock);
+            }
+        } finally
+        {
+            pendingBlocks.clear();
+            recycledBlocks.clear();
+            source.close();
+        }
+    }
+
+    /**
+     * Waits for <var>block</var> to be read or cancelled, ignoring its result.
+     */
+    private static void awaitQuietly(Future<?> block)
+    {
+        boolean interrupted = false;
+        try
+        {
+            while (true)
+            {
+                try
+                {
+                    block.get();
+                    return;
+                } catch (InterruptedException ex)
+                {
+                    interrupted = true;
+                } catch (ExecutionException ex)
+                {
+                    return;
+                } catch (CancellationException ex)
+                {
+                    return;
+                }
+            }
+        } finally
+        {
+            if (interrupted)
+            {
+                Thread.currentThread().interrupt();
+            }
+        }
+    }
+
+}
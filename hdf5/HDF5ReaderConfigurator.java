@@ -27,6 +27,12 @@ import java.io.File;
 class HDF5ReaderConfigurator implements IHDF5ReaderConfigurator
 {
 
+    /** The smallest metadata cache size that the library accepts. */
+    static final long MIN_META_DATA_CACHE_SIZE = 1024L;
+
+    /** The largest metadata cache size that the library accepts. */
+    static final long MAX_META_DATA_CACHE_SIZE = 128L * 1024 * 1024;
+
     protected final File hdf5File;
 
     protected boolean performNumericConversions;
@@ -35,6 +41,12 @@ class HDF5ReaderConfigurator implements IHDF5ReaderConfigurator
 
     protected boolean autoDereference = true;
 
+    protected HDF5ChunkCacheParameters chunkCacheOrNull;
+
+    protected long metaDataCacheSize = -1;
+
+    protected boolean convertCompoundsInJava;
+
     protected HDF5Reader readerWriterOrNull;
 
     HDF5ReaderConfigurator(File hdf5File)
@@ -75,15 +87,43 @@ class HDF5ReaderConfigurator implements IHDF5ReaderConfigurator
         return this;
     }
 
+    @Override
+    public HDF5ReaderConfigurator chunkCache(HDF5ChunkCacheParameters chunkCache)
+    {
+        this.chunkCacheOrNull = chunkCache;
+        return this;
+    }
+
+    @Override
+    public HDF5ReaderConfigurator metaDataCacheSize(long size)
+    {
+        if (size < MIN_META_DATA_CACHE_SIZE || size > MAX_META_DATA_CACHE_SIZE)
+        {
+            throw new IllegalArgumentException("Metadata cache size needs to be between "
+                    + MIN_META_DATA_CACHE_SIZE + " and " + MAX_META_DATA_CACHE_SIZE
+                    + " bytes, found: " + size);
+        }
+        this.metaDataCacheSize = size;
+        return this;
+    }
+
+    @Override
+    public HDF5ReaderConfigurator convertCompoundsInJava()
+    {
+        this.convertCompoundsInJava = true;
+        return this;
+    }
+
     @Override
     public IHDF5Reader reader()
     {
         if (readerWriterOrNull == null)
         {
             readerWriterOrNull =
-                    new HDF5Reader(new HDF5BaseReader(hdf5File, performNumericConversions,
+                    new HDF5Reader(new HDF5BaseReader(hdf5File, performNumericConversions, false,
                             autoDereference, IHDF5WriterConfigurator.FileFormat.ALLOW_1_8, false,
-                            ""));
+                            "", chunkCacheOrNull, new HDF5FileAccessParameters(
+                                    metaDataCacheSize), convertCompoundsInJava));
         }
         return readerWriterOrNull;
     }
@@ -17,6 +17,8 @@
 package ch.systemsx.cisd.hdf5;
 
 import static ch.systemsx.cisd.hdf5.HDF5Utils.getOneDimensionalArraySize;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5S_ALL;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_NATIVE_INT32;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_STRING;
 
 import java.util.Iterator;
@@ -238,6 +240,10 @@ public class HDF5StringReader implements IHDF5StringReader
                     if (baseReader.h5.isVariableLengthString(dataTypeId))
                     {
                         baseReader.h5.readDataSetVL(dataSetId, dataTypeId, data);
+                    } else if (baseReader.isStringDictionaryEncoded(dataSetId, registry))
+                    {
+                        readDictionaryEncoded(objectPath, dataSetId, H5S_ALL, H5S_ALL, data,
+                                null, registry);
                     } else
                     {
                         final boolean isString =
@@ -293,6 +299,16 @@ public class HDF5StringReader implements IHDF5StringReader
 
     String[] readArrayBlockWithOffset(final String objectPath, final int blockSize,
             final long offset, final boolean readRaw)
+    {
+        return readArrayBlockWithOffset(objectPath, blockSize, offset, readRaw, null);
+    }
+
+    /**
+     * @param dictionaryOrNull The dictionary of <var>objectPath</var>, if it is dictionary-encoded
+     *            and the dictionary has already been read, or <code>null</code>.
+     */
+    private String[] readArrayBlockWithOffset(final String objectPath, final int blockSize,
+            final long offset, final boolean readRaw, final String[] dictionaryOrNull)
     {
         assert objectPath != null;
 
@@ -313,6 +329,10 @@ public class HDF5StringReader implements IHDF5StringReader
                     {
                         baseReader.h5.readDataSetVL(dataSetId, dataTypeId,
                                 spaceParams.memorySpaceId, spaceParams.dataSpaceId, data);
+                    } else if (baseReader.isStringDictionaryEncoded(dataSetId, registry))
+                    {
+                        readDictionaryEncoded(objectPath, dataSetId, spaceParams.memorySpaceId,
+                                spaceParams.dataSpaceId, data, dictionaryOrNull, registry);
                     } else
                     {
                         final boolean isString =
@@ -567,6 +587,9 @@ public class HDF5StringReader implements IHDF5StringReader
                 @Override
                 public Iterator<HDF5DataBlock<String[]>> iterator()
                 {
+                    // Read the dictionary once for all blocks.
+                    final String[] dictionaryOrNull =
+                            isDictionaryEncoded(dataSetPath) ? readDictionary(dataSetPath) : null;
                     return new Iterator<HDF5DataBlock<String[]>>()
                         {
                             final HDF5NaturalBlock1DParameters.HDF5NaturalBlock1DIndex index =
@@ -583,10 +606,9 @@ public class HDF5StringReader implements IHDF5StringReader
                             {
                                 final long offset = index.computeOffsetAndSizeGetOffset();
                                 final String[] block =
-                                        readRaw ? readArrayBlockWithOffsetRaw(dataSetPath,
-                                                index.getBlockSize(), offset)
-                                                : readArrayBlockWithOffset(dataSetPath,
-                                                        index.getBlockSize(), offset);
+                                        readArrayBlockWithOffset(dataSetPath,
+                                                index.getBlockSize(), offset, readRaw,
+                                                dictionaryOrNull);
                                 return new HDF5DataBlock<String[]>(block, index.getAndIncIndex(),
                                         offset);
                             }
@@ -615,6 +637,234 @@ public class HDF5StringReader implements IHDF5StringReader
         return getArrayNaturalBlocks(dataSetPath, true);
     }
 
+    @Override
+    public boolean isDictionaryEncoded(final String objectPath)
+    {
+        assert objectPath != null;
+
+        baseReader.checkOpen();
+        final ICallableWithCleanUp<Boolean> readCallable = new ICallableWithCleanUp<Boolean>()
+            {
+                @Override
+                public Boolean call(ICleanUpRegistry registry)
+                {
+                    final int dataSetId =
+                            baseReader.h5.openDataSet(baseReader.fileId, objectPath, registry);
+                    return baseReader.isStringDictionaryEncoded(dataSetId, registry);
+                }
+            };
+        return baseReader.runner.call(readCallable);
+    }
+
+    @Override
+    public String[] readDictionary(final String objectPath) throws HDF5JavaException
+    {
+        assert objectPath != null;
+
+        baseReader.checkOpen();
+        final ICallableWithCleanUp<String[]> readCallable = new ICallableWithCleanUp<String[]>()
+            {
+                @Override
+                public String[] call(ICleanUpRegistry registry)
+                {
+                    final int dataSetId =
+                            baseReader.h5.openDataSet(baseReader.fileId, objectPath, registry);
+                    checkDictionaryEncoded(objectPath, dataSetId, registry);
+                    return readDictionary(dataSetId, objectPath, registry);
+                }
+            };
+        return baseReader.runner.call(readCallable);
+    }
+
+    @Override
+    public int getDictionaryCode(final String objectPath, final String value)
+            throws HDF5JavaException
+    {
+        final String[] dictionary = readDictionary(objectPath);
+        for (int i = 0; i < dictionary.length; ++i)
+        {
+            if (dictionary[i].equals(value))
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    @Override
+    public int[] readDictionaryCodes(final String objectPath) throws HDF5JavaException
+    {
+        return readDictionaryCodesBlockWithOffset(objectPath, -1, 0L);
+    }
+
+    @Override
+    public int[] readDictionaryCodesBlockWithOffset(final String objectPath, final int blockSize,
+            final long offset) throws HDF5JavaException
+    {
+        assert objectPath != null;
+
+        baseReader.checkOpen();
+        final ICallableWithCleanUp<int[]> readCallable = new ICallableWithCleanUp<int[]>()
+            {
+                @Override
+                public int[] call(ICleanUpRegistry registry)
+                {
+                    final int dataSetId =
+                            baseReader.h5.openDataSet(baseReader.fileId, objectPath, registry);
+                    checkDictionaryEncoded(objectPath, dataSetId, registry);
+                    final DataSpaceParameters spaceParams =
+                            baseReader.getSpaceParameters(dataSetId, offset, blockSize, registry);
+                    final int[] codes = new int[spaceParams.blockSize];
+                    baseReader.h5.readDataSet(dataSetId, H5T_NATIVE_INT32,
+                            spaceParams.memorySpaceId, spaceParams.dataSpaceId, codes);
+                    return codes;
+                }
+            };
+        return baseReader.runner.call(readCallable);
+    }
+
+    private void checkDictionaryEncoded(String objectPath, int dataSetId,
+            ICleanUpRegistry registry) throws HDF5JavaException
+    {
+        if (baseReader.isStringDictionaryEncoded(dataSetId, registry) == false)
+        {
+            throw new HDF5JavaException(objectPath
+                    + " is not a dictionary-encoded string data set.");
+        }
+    }
+
+    private String[] readDictionary(int dataSetId, String objectPath, ICleanUpRegistry registry)
+    {
+        final int dictionaryId =
+                baseReader.h5.openDataSet(baseReader.fileId,
+                        baseReader.getStringDictionaryPath(dataSetId, objectPath, registry),
+                        registry);
+        final long[] dimensions = baseReader.h5.getDataDimensions(dictionaryId, registry);
+        final String[] dictionary = new String[getOneDimensionalArraySize(dimensions)];
+        final int dataTypeId = baseReader.h5.getNativeDataTypeForDataSet(dictionaryId, registry);
+        if (baseReader.h5.isVariableLengthString(dataTypeId))
+        {
+            baseReader.h5.readDataSetVL(dictionaryId, dataTypeId, dictionary);
+        } else
+        {
+            baseReader.h5.readDataSetString(dictionaryId, dataTypeId, dictionary);
+        }
+        return dictionary;
+    }
+
+    private void readDictionaryEncoded(String objectPath, int dataSetId, int memorySpaceId,
+            int fileSpaceId, String[] data, String[] dictionaryOrNull, ICleanUpRegistry registry)
+            throws HDF5JavaException
+    {
+        final int[] codes = new int[data.length];
+        baseReader.h5.readDataSet(dataSetId, H5T_NATIVE_INT32, memorySpaceId, fileSpaceId, codes);
+        final String[] dictionary =
+                (dictionaryOrNull != null) ? dictionaryOrNull : readDictionary(dataSetId,
+                        objectPath, registry);
+        for (int i = 0; i < codes.length; ++i)
+        {
+            final int code = codes[i];
+            if (code < 0 || code >= dictionary.length)
+            {
+                throw new HDF5JavaException("Code " + code + " at index " + i + " of "
+                        + objectPath + " is not in the dictionary of size " + dictionary.length
+                        + ".");
+            }
+            data[i] = dictionary[code];
+        }
+    }
+
+    @Override
+    public HDF5PackedStringArray readArrayPacked(final String objectPath)
+            throws HDF5JavaException
+    {
+        return readArrayBlockWithOffsetPacked(objectPath, -1, 0L);
+    }
+
+    @Override
+    public HDF5PackedStringArray readArrayBlockWithOffsetPacked(final String objectPath,
+            final int blockSize, final long offset) throws HDF5JavaException
+    {
+        assert objectPath != null;
+
+        baseReader.checkOpen();
+        final ICallableWithCleanUp<HDF5PackedStringArray> readCallable =
+                new ICallableWithCleanUp<HDF5PackedStringArray>()
+                    {
+                        @Override
+                        public HDF5PackedStringArray call(ICleanUpRegistry registry)
+                        {
+                            final int dataSetId =
+                                    baseReader.h5.openDataSet(baseReader.fileId, objectPath,
+                                            registry);
+                            final DataSpaceParameters spaceParams =
+                                    baseReader.getSpaceParameters(dataSetId, offset, blockSize,
+                                            registry);
+                            final int dataTypeId =
+                                    baseReader.h5.getNativeDataTypeForDataSet(dataSetId, registry);
+                            if (baseReader.h5.getClassType(dataTypeId) != H5T_STRING
+                                    || baseReader.h5.isVariableLengthString(dataTypeId))
+                            {
+                                throw new HDF5JavaException(objectPath
+                                        + " needs to be a fixed-length String.");
+                            }
+                            final int strLength = baseReader.h5.getDataTypeSize(dataTypeId);
+                            final byte[] bdata = new byte[spaceParams.blockSize * strLength];
+                            baseReader.h5.readDataSetNonNumeric(dataSetId, dataTypeId,
+                                    spaceParams.memorySpaceId, spaceParams.dataSpaceId, bdata);
+                            return new HDF5PackedStringArray(bdata, strLength,
+                                    spaceParams.blockSize,
+                                    baseReader.h5.getCharacterEncoding(dataTypeId));
+                        }
+                    };
+        return baseReader.runner.call(readCallable);
+    }
+
+    @Override
+    public Iterable<HDF5DataBlock<HDF5PackedStringArray>> getArrayNaturalBlocksPacked(
+            final String dataSetPath) throws HDF5JavaException
+    {
+        baseReader.checkOpen();
+        final HDF5NaturalBlock1DParameters params =
+                new HDF5NaturalBlock1DParameters(baseReader.getDataSetInformation(dataSetPath));
+
+        return new Iterable<HDF5DataBlock<HDF5PackedStringArray>>()
+            {
+                @Override
+                public Iterator<HDF5DataBlock<HDF5PackedStringArray>> iterator()
+                {
+                    return new Iterator<HDF5DataBlock<HDF5PackedStringArray>>()
+                        {
+                            final HDF5NaturalBlock1DParameters.HDF5NaturalBlock1DIndex index =
+                                    params.getNaturalBlockIndex();
+
+                            @Override
+                            public boolean hasNext()
+                            {
+                                return index.hasNext();
+                            }
+
+                            @Override
+                            public HDF5DataBlock<HDF5PackedStringArray> next()
+                            {
+                                final long offset = index.computeOffsetAndSizeGetOffset();
+                                final HDF5PackedStringArray block =
+                                        readArrayBlockWithOffsetPacked(dataSetPath,
+                                                index.getBlockSize(), offset);
+                                return new HDF5DataBlock<HDF5PackedStringArray>(block,
+                                        index.getAndIncIndex(), offset);
+                            }
+
+                            @Override
+                            public void remove()
+                            {
+                                throw new UnsupportedOperationException();
+                            }
+                        };
+                }
+            };
+    }
+
     Iterable<HDF5MDDataBlock<MDArray<String>>> getMDArrayNaturalBlocks(final String objectPath,
             final boolean readRaw)
     {
@@ -17,9 +17,22 @@
 package ch.systemsx.cisd.hdf5;
 
 import static ch.systemsx.cisd.hdf5.HDF5GenericStorageFeatures.GENERIC_NO_COMPRESSION;
+import static ch.systemsx.cisd.hdf5.HDF5Utils.getStringDictionaryAttributeName;
+import static ch.systemsx.cisd.hdf5.HDF5Utils.getStringDictionaryPath;
 import static ch.systemsx.cisd.hdf5.hdf5lib.H5D.H5Dwrite;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5P_DEFAULT;
 import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5S_ALL;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_NATIVE_INT32;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_STD_I16LE;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_STD_I32LE;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_STD_I8LE;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_STD_REF_OBJ;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
 import ncsa.hdf.hdf5lib.exceptions.HDF5Exception;
 import ncsa.hdf.hdf5lib.exceptions.HDF5JavaException;
 import ncsa.hdf.hdf5lib.exceptions.HDF5LibraryException;
@@ -258,7 +271,7 @@ public class HDF5StringWriter extends HDF5StringReader implements IHDF5StringWri
                     boolean exists = baseWriter.h5.exists(baseWriter.fileId, objectPath);
                     if (exists && baseWriter.keepDataIfExists(features) == false)
                     {
-                        baseWriter.h5.deleteObject(baseWriter.fileId, objectPath);
+                        baseWriter.deleteObjectAndDictionary(objectPath);
                         exists = false;
                     }
                     final int stringDataTypeId =
@@ -348,6 +361,94 @@ public class HDF5StringWriter extends HDF5StringReader implements IHDF5StringWri
         writeStringArray(objectPath, data, maxLength, false, features, false);
     }
 
+    @Override
+    public void writeArrayDictionaryEncoded(final String objectPath, final String[] data)
+    {
+        writeArrayDictionaryEncoded(objectPath, data, GENERIC_NO_COMPRESSION);
+    }
+
+    @Override
+    public void writeArrayDictionaryEncoded(final String objectPath, final String[] data,
+            final HDF5GenericStorageFeatures features)
+    {
+        assert objectPath != null;
+        assert data != null;
+
+        final Map<String, Integer> codeMap = new HashMap<String, Integer>();
+        final List<String> dictionaryList = new ArrayList<String>();
+        final int[] codes = new int[data.length];
+        for (int i = 0; i < data.length; ++i)
+        {
+            Integer code = codeMap.get(data[i]);
+            if (code == null)
+            {
+                code = dictionaryList.size();
+                codeMap.put(data[i], code);
+                dictionaryList.add(data[i]);
+            }
+            codes[i] = code;
+        }
+        final String[] dictionary = dictionaryList.toArray(new String[dictionaryList.size()]);
+        final String dictionaryPath =
+                getStringDictionaryPath(objectPath, baseWriter.houseKeepingNameSuffix);
+        baseWriter.checkOpen();
+        // Done before writing the new dictionary, which may be at the path of the old one.
+        if (baseWriter.keepDataIfExists(features))
+        {
+            // The data set is kept, but refers to the new dictionary.
+            final String oldDictionaryPathOrNull =
+                    baseWriter.tryGetOwnStringDictionaryPath(objectPath);
+            if (oldDictionaryPathOrNull != null
+                    && oldDictionaryPathOrNull.equals(dictionaryPath) == false
+                    && baseWriter.h5.exists(baseWriter.fileId, oldDictionaryPathOrNull))
+            {
+                baseWriter.h5.deleteObject(baseWriter.fileId, oldDictionaryPathOrNull);
+            }
+        } else if (baseWriter.h5.exists(baseWriter.fileId, objectPath))
+        {
+            baseWriter.deleteObjectAndDictionary(objectPath);
+        }
+        writeStringArray(dictionaryPath, dictionary, getMaxLength(dictionary), true, features,
+                false);
+
+        final ICallableWithCleanUp<Void> writeRunnable = new ICallableWithCleanUp<Void>()
+            {
+                @Override
+                public Void call(ICleanUpRegistry registry)
+                {
+                    final int storageTypeId;
+                    final int elementSize;
+                    if (dictionary.length <= Byte.MAX_VALUE + 1)
+                    {
+                        storageTypeId = H5T_STD_I8LE;
+                        elementSize = 1;
+                    } else if (dictionary.length <= Short.MAX_VALUE + 1)
+                    {
+                        storageTypeId = H5T_STD_I16LE;
+                        elementSize = 2;
+                    } else
+                    {
+                        storageTypeId = H5T_STD_I32LE;
+                        elementSize = 4;
+                    }
+                    final int dataSetId =
+                            baseWriter.getOrCreateDataSetId(objectPath, storageTypeId, new long[]
+                                { codes.length }, elementSize, features, registry);
+                    H5Dwrite(dataSetId, H5T_NATIVE_INT32, H5S_ALL, H5S_ALL, H5P_DEFAULT, codes);
+                    baseWriter.setTypeVariant(dataSetId, HDF5DataTypeVariant.STRING_DICTIONARY,
+                            registry);
+                    final byte[] dictionaryReference =
+                            baseWriter.h5.createObjectReference(baseWriter.fileId,
+                                    dictionaryPath);
+                    baseWriter.setAttribute(dataSetId,
+                            getStringDictionaryAttributeName(baseWriter.houseKeepingNameSuffix),
+                            H5T_STD_REF_OBJ, H5T_STD_REF_OBJ, -1, dictionaryReference, registry);
+                    return null; // Nothing to return.
+                }
+            };
+        baseWriter.runner.call(writeRunnable);
+    }
+
     private void writeStringArray(final String objectPath, final String[] data,
             final int maxLength, final boolean lengthFitsValue,
             final HDF5GenericStorageFeatures features, final boolean variableLength)
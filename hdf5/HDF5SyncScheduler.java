@@ -0,0 +1,488 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5;
+
+import java.io.IOException;
+import java.io.RandomAccessFile;
+import java.util.ArrayList;
+import java.util.LinkedHashSet;
+import java.util.List;
+import java.util.Set;
+import java.util.concurrent.Callable;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Future;
+import java.util.concurrent.FutureTask;
+import java.util.concurrent.LinkedBlockingQueue;
+import java.util.concurrent.RejectedExecutionException;
+import java.util.concurrent.TimeUnit;
+
+import ncsa.hdf.hdf5lib.exceptions.HDF5JavaException;
+
+import ch.systemsx.cisd.base.exceptions.CheckedExceptionTunnel;
+import ch.systemsx.cisd.base.namedthread.NamingThreadPoolExecutor;
+
+/**
+ * A scheduler for <code>fsync(2)</code> calls of HDF5 files, shared by all writers.
+ * <p>
+ * Sync requests are grouped per file: a request joins the sync of its file that is waiting to
+ * start, if there is one, so any number of requests that come in while a sync is waiting or running
+ * lead to one more sync. The syncs of a file never run concurrently, the syncs of different files
+ * run on a bounded pool of threads. Each request is answered with a {@link Future} that is done
+ * when the file has been synced.
+ *
+ * @author Bernd Rinn
+ */
+final class HDF5SyncScheduler
+{
+
+    /**
+     * A file to sync.
+     */
+    final class Target
+    {
+        private final RandomAccessFile fileOrNull;
+
+        private final Runnable closeOnExit;
+
+        private final Statistics statistics = new Statistics();
+
+        /** The sync that is waiting to start, joined by new requests. */
+        private Batch waitingOrNull;
+
+        /** The sync that is running. */
+        private Batch runningOrNull;
+
+        private boolean closeRequested;
+
+        private Target(RandomAccessFile fileOrNull, Runnable closeOnExit)
+        {
+            this.fileOrNull = fileOrNull;
+            this.closeOnExit = closeOnExit;
+        }
+
+        /**
+         * Returns the statistics of the syncs of this file.
+         */
+        HDF5SyncStatistics getStatistics()
+        {
+            return statistics.snapshot();
+        }
+
+        /**
+         * Adds a request to the waiting sync, creating it if needed. Needs to be called with the
+         * monitor of this target held.
+         */
+        private Batch addRequest(long requestTime)
+        {
+            if (closeRequested)
+            {
+                throw new HDF5JavaException("File for syncing has already been closed.");
+            }
+            if (waitingOrNull == null)
+            {
+                waitingOrNull = new Batch(this);
+                statistics.queued();
+                globalStatistics.queued();
+            }
+            waitingOrNull.addRequest(requestTime);
+            statistics.requested();
+            globalStatistics.requested();
+            return waitingOrNull;
+        }
+
+        private void closeFile()
+        {
+            if (fileOrNull == null)
+            {
+                return;
+            }
+            try
+            {
+                fileOrNull.close();
+            } catch (IOException ex)
+            {
+                throw new HDF5JavaException("Error closing file: " + ex.getMessage());
+            }
+        }
+    }
+
+    /**
+     * One sync of a file that answers all requests that have joined it before it started.
+     */
+    private final class Batch extends FutureTask<Void>
+    {
+        private final Target target;
+
+        private int numberOfRequests;
+
+        private long sumOfRequestTimes;
+
+        private long firstRequestTime;
+
+        Batch(final Target target)
+        {
+            super(new Callable<Void>()
+                {
+                    @Override
+                    public Void call() throws Exception
+                    {
+                        if (target.fileOrNull != null)
+                        {
+                            syncNow(target.fileOrNull);
+                        }
+                        return null; // Nothing to return.
+                    }
+                });
+            this.target = target;
+        }
+
+        void addRequest(long requestTime)
+        {
+            if (numberOfRequests == 0)
+            {
+                firstRequestTime = requestTime;
+            }
+            ++numberOfRequests;
+            sumOfRequestTimes += requestTime;
+        }
+
+        /**
+         * A sync cannot be cancelled as other requests may have joined it.
+         */
+        @Override
+        public boolean cancel(boolean mayInterruptIfRunning)
+        {
+            return false;
+        }
+
+        @Override
+        public void run()
+        {
+            final int requests;
+            final long sumOfTimes;
+            final long firstTime;
+            synchronized (target)
+            {
+                target.waitingOrNull = null;
+                target.runningOrNull = this;
+                requests = numberOfRequests;
+                sumOfTimes = sumOfRequestTimes;
+                firstTime = firstRequestTime;
+                target.statistics.started();
+                globalStatistics.started();
+            }
+            final long start = System.nanoTime();
+            try
+            {
+                super.run();
+            } finally
+            {
+                final long end = System.nanoTime();
+                final boolean failed = isFailed();
+                target.statistics.finished(requests, sumOfTimes, firstTime, start, end, failed);
+                globalStatistics.finished(requests, sumOfTimes, firstTime, start, end, failed);
+                synchronized (target)
+                {
+                    target.runningOrNull = null;
+                    if (target.waitingOrNull != null)
+                    {
+                        execute(target.waitingOrNull);
+                    } else if (target.closeRequested)
+                    {
+                        target.closeFile();
+                    }
+                }
+            }
+        }
+
+        private boolean isFailed()
+        {
+            try
+            {
+                get();
+                return false;
+            } catch (ExecutionException ex)
+            {
+                return true;
+            } catch (InterruptedException ex)
+            {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * The counters behind {@link HDF5SyncStatistics}.
+     */
+    private static final class Statistics
+    {
+        private long requests;
+
+        private long answeredRequests;
+
+        private long syncs;
+
+        private long failedSyncs;
+
+        private int queueDepth;
+
+        private int maxQueueDepth;
+
+        private long totalLatencyNanos;
+
+        private long maxLatencyNanos;
+
+        private long totalSyncNanos;
+
+        private long maxSyncNanos;
+
+        synchronized void requested()
+        {
+            ++requests;
+        }
+
+        synchronized void queued()
+        {
+            ++queueDepth;
+            maxQueueDepth = Math.max(maxQueueDepth, queueDepth);
+        }
+
+        synchronized void started()
+        {
+            --queueDepth;
+        }
+
+        synchronized void finished(int numberOfRequests, long sumOfRequestTimes,
+                long firstRequestTime, long start, long end, boolean failed)
+        {
+            answeredRequests += numberOfRequests;
+            ++syncs;
+            if (failed)
+            {
+                ++failedSyncs;
+            }
+            totalLatencyNanos += numberOfRequests * end - sumOfRequestTimes;
+            maxLatencyNanos = Math.max(maxLatencyNanos, end - firstRequestTime);
+            totalSyncNanos += end - start;
+            maxSyncNanos = Math.max(maxSyncNanos, end - start);
+        }
+
+        synchronized HDF5SyncStatistics snapshot()
+        {
+            return new HDF5SyncStatistics(requests, answeredRequests, syncs, failedSyncs,
+                    queueDepth, maxQueueDepth, totalLatencyNanos, maxLatencyNanos,
+                    totalSyncNanos, maxSyncNanos);
+        }
+    }
+
+    private final ExecutorService syncExecutor;
+
+    private final Statistics globalStatistics = new Statistics();
+
+    private final Set<Target> openTargets = new LinkedHashSet<Target>();
+
+    /**
+     * Creates a scheduler that syncs on up to <var>numberOfThreads</var> files at a time.
+     */
+    HDF5SyncScheduler(int numberOfThreads)
+    {
+        if (numberOfThreads < 1)
+        {
+            throw new IllegalArgumentException("Number of threads needs to be >= 1, found: "
+                    + numberOfThreads);
+        }
+        this.syncExecutor =
+                new NamingThreadPoolExecutor("HDF5 Sync", numberOfThreads, numberOfThreads, 0L,
+                        TimeUnit.MILLISECONDS, new LinkedBlockingQueue<Runnable>()).daemonize();
+    }
+
+    /**
+     * Registers <var>fileOrNull</var> for syncing.
+     *
+     * @param fileOrNull The file to sync, or <code>null</code>, if there is nothing to sync, e.g.
+     *            for a file that is kept in memory. Syncs of such a target return right away.
+     * @param closeOnExit Called on {@link #shutdown(int)} if the file has not been closed by then.
+     */
+    Target register(RandomAccessFile fileOrNull, Runnable closeOnExit)
+    {
+        final Target target = new Target(fileOrNull, closeOnExit);
+        synchronized (openTargets)
+        {
+            openTargets.add(target);
+        }
+        return target;
+    }
+
+    /**
+     * Requests a sync of <var>target</var> without waiting for it.
+     *
+     * @return A future that is done when the data written to the file before this call is durable.
+     */
+    Future<Void> requestSync(Target target)
+    {
+        synchronized (target)
+        {
+            final boolean isNew = (target.waitingOrNull == null);
+            final Batch batch = target.addRequest(System.nanoTime());
+            if (isNew && target.runningOrNull == null)
+            {
+                execute(batch);
+            }
+            return batch;
+        }
+    }
+
+    /**
+     * Syncs <var>target</var> and waits for it. If no sync of the file is waiting or running, the
+     * sync is run in the current thread.
+     */
+    void sync(Target target)
+    {
+        final Batch batch;
+        final boolean inline;
+        synchronized (target)
+        {
+            inline = (target.waitingOrNull == null && target.runningOrNull == null);
+            batch = target.addRequest(System.nanoTime());
+            if (inline)
+            {
+                // Mark the batch as running right away so that no other thread executes it.
+                target.runningOrNull = batch;
+            }
+        }
+        if (inline)
+        {
+            batch.run();
+        }
+        await(batch);
+    }
+
+    /**
+     * Closes the file of <var>target</var>, once the syncs that have been requested are done.
+     */
+    void close(Target target)
+    {
+        synchronized (openTargets)
+        {
+            openTargets.remove(target);
+        }
+        synchronized (target)
+        {
+            if (target.closeRequested)
+            {
+                return;
+            }
+            target.closeRequested = true;
+            if (target.waitingOrNull == null && target.runningOrNull == null)
+            {
+                target.closeFile();
+            }
+        }
+    }
+
+    /**
+     * Returns the statistics of the syncs of all files.
+     */
+    HDF5SyncStatistics getStatistics()
+    {
+        return globalStatistics.snapshot();
+    }
+
+    /**
+     * Closes all files that are still open and waits up to <var>timeoutSeconds</var> for their
+     * syncs to finish. To be called on exit of the JVM.
+     */
+    void shutdown(int timeoutSeconds)
+    {
+        final List<Target> targets;
+        synchronized (openTargets)
+        {
+            targets = new ArrayList<Target>(openTargets);
+        }
+        for (Target target : targets)
+        {
+            try
+            {
+                target.closeOnExit.run();
+            } catch (RuntimeException ex)
+            {
+                ex.printStackTrace();
+            }
+        }
+        syncExecutor.shutdown();
+        try
+        {
+            syncExecutor.awaitTermination(timeoutSeconds, TimeUnit.SECONDS);
+        } catch (InterruptedException ex)
+        {
+            // Unexpected
+            ex.printStackTrace();
+        }
+    }
+
+    private void execute(Batch batch)
+    {
+        try
+        {
+            syncExecutor.execute(batch);
+        } catch (RejectedExecutionException ex)
+        {
+            // The scheduler is shutting down, sync in the current thread.
+            batch.run();
+        }
+    }
+
+    /**
+     * Waits for <var>future</var>, a sync of this scheduler, and re-throws its exception.
+     */
+    static void await(Future<Void> future)
+    {
+        try
+        {
+            future.get();
+        } catch (ExecutionException ex)
+        {
+            throw CheckedExceptionTunnel.wrapIfNecessary(ex.getCause());
+        } catch (InterruptedException ex)
+        {
+            throw CheckedExceptionTunnel.wrapIfNecessary(ex);
+        }
+    }
+
+    /**
+     * Calls <code>fsync(2)</code> on <var>file</var> in the current thread.
+     */
+    private static void syncNow(RandomAccessFile file)
+    {
+        try
+        {
+            // Implementation note 1: Unix will call fsync(), , Windows: FlushFileBuffers()
+            // Implementation note 2: We do not call file.getChannel().force(false) which
+            // might be better in terms of performance as if shutdownNow() already has been
+            // triggered on the syncExecutor and thus this thread has already been interrupted,
+            // channel methods would throw a ClosedByInterruptException at us no matter what we do.
+            file.getFD().sync();
+        } catch (IOException ex)
+        {
+            final String msg =
+                    (ex.getMessage() == null) ? ex.getClass().getSimpleName() : ex.getMessage();
+            throw new HDF5JavaException("Error syncing file: " + msg);
+        }
+    }
+
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5;
+
+/**
+ * A snapshot of the statistics of the <code>fsync(2)</code> calls of one HDF5 file or of all HDF5
+ * files written by this JVM.
+ * <p>
+ * A sync request is a flush in one of the sync modes or a call of
+ * {@link IHDF5FileLevelReadWriteHandler#flushAsync()}. Requests that come in while a sync of the
+ * same file is waiting to start are answered by that sync, so there are usually fewer syncs than
+ * requests. The latency of a request is the time from the request until the file is synced.
+ *
+ * @author Bernd Rinn
+ */
+public final class HDF5SyncStatistics
+{
+
+    private final long numberOfRequests;
+
+    private final long numberOfAnsweredRequests;
+
+    private final long numberOfSyncs;
+
+    private final long numberOfFailedSyncs;
+
+    private final int queueDepth;
+
+    private final int maxQueueDepth;
+
+    private final long totalLatencyNanos;
+
+    private final long maxLatencyNanos;
+
+    private final long totalSyncNanos;
+
+    private final long maxSyncNanos;
+
+    HDF5SyncStatistics(long numberOfRequests, long numberOfAnsweredRequests, long numberOfSyncs,
+            long numberOfFailedSyncs, int queueDepth, int maxQueueDepth, long totalLatencyNanos,
+            long maxLatencyNanos, long totalSyncNanos, long maxSyncNanos)
+    {
+        this.numberOfRequests = numberOfRequests;
+        this.numberOfAnsweredRequests = numberOfAnsweredRequests;
+        this.numberOfSyncs = numberOfSyncs;
+        this.numberOfFailedSyncs = numberOfFailedSyncs;
+        this.queueDepth = queueDepth;
+        this.maxQueueDepth = maxQueueDepth;
+        this.totalLatencyNanos = totalLatencyNanos;
+        this.maxLatencyNanos = maxLatencyNanos;
+        this.totalSyncNanos = totalSyncNanos;
+        this.maxSyncNanos = maxSyncNanos;
+    }
+
+    /**
+     * Returns the number of sync requests.
+     */
+    public long getNumberOfRequests()
+    {
+        return numberOfRequests;
+    }
+
+    /**
+     * Returns the number of sync requests that have been answered, that is, whose sync is done.
+     */
+    public long getNumberOfAnsweredRequests()
+    {
+        return numberOfAnsweredRequests;
+    }
+
+    /**
+     * Returns the number of syncs that have been performed, including the failed ones.
+     */
+    public long getNumberOfSyncs()
+    {
+        return numberOfSyncs;
+    }
+
+    /**
+     * Returns the number of syncs that have failed.
+     */
+    public long getNumberOfFailedSyncs()
+    {
+        return numberOfFailedSyncs;
+    }
+
+    /**
+     * Returns the number of syncs that are waiting to start.
+     */
+    public int getQueueDepth()
+    {
+        return queueDepth;
+    }
+
+    /**
+     * Returns the largest number of syncs that have been waiting to start at the same time.
+     */
+    public int getMaxQueueDepth()
+    {
+        return maxQueueDepth;
+    }
+
+    /**
+     * Returns the mean latency of the requests that have been answered, in nanoseconds.
+     */
+    public long getMeanLatencyNanos()
+    {
+        return (numberOfAnsweredRequests == 0) ? 0 : totalLatencyNanos
+                / numberOfAnsweredRequests;
+    }
+
+    /**
+     * Returns the largest latency of a request, in nanoseconds.
+     */
+    public long getMaxLatencyNanos()
+    {
+        return maxLatencyNanos;
+    }
+
+    /**
+     * Returns the mean time a sync took, in nanoseconds.
+     */
+    public long getMeanSyncNanos()
+    {
+        return (numberOfSyncs == 0) ? 0 : totalSyncNanos / numberOfSyncs;
+    }
+
+    /**
+     * Returns the largest time a sync took, in nanoseconds.
+     */
+    public long getMaxSyncNanos()
+    {
+        return maxSyncNanos;
+    }
+
+    @Override
+    public String toString()
+    {
+        return "HDF5SyncStatistics [numberOfRequests=" + numberOfRequests
+                + ", numberOfAnsweredRequests=" + numberOfAnsweredRequests + ", numberOfSyncs="
+                + numberOfSyncs + ", numberOfFailedSyncs=" + numberOfFailedSyncs
+                + ", queueDepth=" + queueDepth + ", maxQueueDepth=" + maxQueueDepth
+                + ", meanLatencyNanos=" + getMeanLatencyNanos() + ", maxLatencyNanos="
+                + maxLatencyNanos + ", meanSyncNanos=" + getMeanSyncNanos() + ", maxSyncNanos="
+                + maxSyncNanos + "]";
+    }
+
+}
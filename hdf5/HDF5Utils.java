@@ -23,6 +23,7 @@ import java.util.List;
 import ncsa.hdf.hdf5lib.exceptions.HDF5JavaException;
 
 import ch.rinn.restrictions.Private;
+import ch.systemsx.cisd.hdf5.HDF5AbstractStorageFeatures.ChunkAccessPattern;
 
 /**
  * Some utility methods used by {@link HDF5Reader} and {@link HDF5Writer}.
@@ -46,6 +47,9 @@ final class HDF5Utils
     @Private
     static final int MIN_CHUNK_SIZE = 1;
 
+    /** The maximal size of a chunk in bytes that the HDF5 library supports. */
+    private static final long MAX_CHUNK_SIZE = 0xFFFFFFFFL;
+
     /** The minimal size of a data set in order to allow for chunking. */
     private static final long MIN_TOTAL_SIZE_FOR_CHUNKING = 128L;
 
@@ -108,6 +112,27 @@ final class HDF5Utils
                 : "TYPE_VARIANT_MEMBERS" + houseKeepingNameSuffix;
     }
 
+    /**
+     * Returns the path of the dictionary data set of the dictionary-encoded string data set
+     * <var>objectPath</var>. This is where the dictionary is written to and where it is moved to
+     * along with the data set. Readers follow the reference in the attribute
+     * {@link #getStringDictionaryAttributeName(String)}.
+     */
+    static String getStringDictionaryPath(String objectPath, String houseKeepingNameSuffix)
+    {
+        return toHouseKeepingPath(objectPath + "_DICTIONARY", houseKeepingNameSuffix);
+    }
+
+    /**
+     * Returns the attribute that holds the object reference to the dictionary data set of a
+     * dictionary-encoded string data set.
+     */
+    static String getStringDictionaryAttributeName(String houseKeepingNameSuffix)
+    {
+        return "".equals(houseKeepingNameSuffix) ? "__STRING_DICTIONARY__" : "STRING_DICTIONARY"
+                + houseKeepingNameSuffix;
+    }
+
     /** Returns the attribute to store the name of the enum data type. */
     static String getEnumTypeNameAttributeName(String houseKeepingNameSuffix)
     {
@@ -232,9 +257,13 @@ final class HDF5Utils
     /**
      * Returns a chunk size suitable for a data set with <var>dimension</var>, or <code>null</code>,
      * if this data set can't be reasonably chunk-ed.
+     * <p>
+     * A data set that fits into <var>targetChunkSize</var> bytes gets one chunk. Larger data sets
+     * get chunks of at most <var>targetChunkSize</var> bytes, shaped for <var>accessPattern</var>
+     * (see {@link #planChunkSize(long[], int, ChunkAccessPattern, long)}).
      */
     static long[] tryGetChunkSize(final long[] dimensions, int elementLength, boolean tryChunkedDS,
-            boolean enforceChunkedDS)
+            boolean enforceChunkedDS, ChunkAccessPattern accessPattern, long targetChunkSize)
     {
         assert dimensions != null;
 
@@ -242,20 +271,109 @@ final class HDF5Utils
         {
             return null;
         }
-        final long[] chunkSize = new long[dimensions.length];
         long totalSize = elementLength;
         for (int i = 0; i < dimensions.length; ++i)
         {
             totalSize *= dimensions[i];
-            chunkSize[i] = Math.max(MIN_CHUNK_SIZE, dimensions[i]);
         }
         if (enforceChunkedDS == false && totalSize < MIN_TOTAL_SIZE_FOR_CHUNKING)
         {
             return null;
         }
+        return planChunkSize(dimensions, elementLength, accessPattern, targetChunkSize);
+    }
+
+    /**
+     * Plans the chunk size of a data set with <var>dimensions</var>. Starts from one chunk for the
+     * whole data set and shrinks it until it has no more than <var>targetChunkSize</var> bytes,
+     * and never more than the HDF5 limit of 4GB:
+     * <ul>
+     * <li>{@link ChunkAccessPattern#TILES}: halves the largest chunk dimension until the chunk is
+     * small enough.</li>
+     * <li>{@link ChunkAccessPattern#ROW_SCAN}: shrinks the first dimension, then the second and so
+     * on.</li>
+     * <li>{@link ChunkAccessPattern#COLUMN_SCAN}: shrinks the last dimension, then the one before
+     * and so on.</li>
+     * <li>{@link ChunkAccessPattern#APPEND_ALONG_FIRST_AXIS}: like <code>ROW_SCAN</code>, but the
+     * first dimension is then set to fill the chunk up to <var>targetChunkSize</var>.</li>
+     * </ul>
+     */
+    static long[] planChunkSize(final long[] dimensions, int elementLength,
+            ChunkAccessPattern accessPattern, long targetChunkSize)
+    {
+        final long maxChunkSize =
+                Math.max(elementLength, Math.min(targetChunkSize, MAX_CHUNK_SIZE));
+        final long[] chunkSize = new long[dimensions.length];
+        for (int i = 0; i < dimensions.length; ++i)
+        {
+            chunkSize[i] = Math.max(MIN_CHUNK_SIZE, dimensions[i]);
+        }
+        final boolean append =
+                (accessPattern == ChunkAccessPattern.APPEND_ALONG_FIRST_AXIS)
+                        && chunkSize.length > 0;
+        if (append)
+        {
+            chunkSize[0] = MIN_CHUNK_SIZE;
+        }
+        long chunkBytes = getChunkBytes(chunkSize, elementLength);
+        switch (accessPattern)
+        {
+            case TILES:
+                while (chunkBytes > maxChunkSize)
+                {
+                    int largestIdx = 0;
+                    for (int i = 1; i < chunkSize.length; ++i)
+                    {
+                        if (chunkSize[i] > chunkSize[largestIdx])
+                        {
+                            largestIdx = i;
+                        }
+                    }
+                    chunkSize[largestIdx] = (chunkSize[largestIdx] + 1) / 2;
+                    chunkBytes = getChunkBytes(chunkSize, elementLength);
+                }
+                break;
+            case COLUMN_SCAN:
+                for (int i = chunkSize.length - 1; i >= 0 && chunkBytes > maxChunkSize; --i)
+                {
+                    chunkBytes = shrinkToFit(chunkSize, i, chunkBytes, maxChunkSize);
+                }
+                break;
+            default:
+                for (int i = 0; i < chunkSize.length && chunkBytes > maxChunkSize; ++i)
+                {
+                    chunkBytes = shrinkToFit(chunkSize, i, chunkBytes, maxChunkSize);
+                }
+                break;
+        }
+        if (append)
+        {
+            chunkSize[0] = Math.max(MIN_CHUNK_SIZE, maxChunkSize / chunkBytes);
+        }
         return chunkSize;
     }
 
+    private static long getChunkBytes(long[] chunkSize, int elementLength)
+    {
+        long chunkBytes = elementLength;
+        for (long size : chunkSize)
+        {
+            chunkBytes *= size;
+        }
+        return chunkBytes;
+    }
+
+    /**
+     * Shrinks dimension <var>idx</var> of <var>chunkSize</var> so that the chunk has no more than
+     * <var>maxChunkSize</var> bytes, if possible, and returns the new size of the chunk in bytes.
+     */
+    private static long shrinkToFit(long[] chunkSize, int idx, long chunkBytes, long maxChunkSize)
+    {
+        final long bytesPerSlice = chunkBytes / chunkSize[idx];
+        chunkSize[idx] = Math.max(MIN_CHUNK_SIZE, maxChunkSize / bytesPerSlice);
+        return bytesPerSlice * chunkSize[idx];
+    }
+
     /**
      * Returns a path for a data type with <var>name</var> and (optional) <var>appendices</var>.
      * <p>
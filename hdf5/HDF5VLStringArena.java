@@ -0,0 +1,105 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5;
+
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.Map;
+
+import ch.systemsx.cisd.hdf5.hdf5lib.HDFNativeData;
+
+/**
+ * The native variable-length strings of the compound records of one batch that is written.
+ * <p>
+ * Each distinct string of the batch is copied to native memory only once, all records that hold
+ * the same string share its pointer. The pointers are kept in one contiguous table, so all strings
+ * of the batch are freed with a single native call in {@link #release()}, rather than by scanning
+ * the variable-length members of every record.
+ * <p>
+ * The strings themselves are still allocated one by one. Only the copying of duplicates and the
+ * per-record reclaiming are saved.
+ * <p>
+ * <i>This class is not thread-safe.</i>
+ * 
+ * @author Bernd Rinn
+ */
+final class HDF5VLStringArena
+{
+
+    private static final int INITIAL_CAPACITY = 64;
+
+    private final int wordSize = HDFNativeData.getMachineWordSize();
+
+    private final Map<String, Integer> slots = new HashMap<String, Integer>();
+
+    private byte[] pointers = new byte[INITIAL_CAPACITY * wordSize];
+
+    private int count;
+
+    /**
+     * Writes the pointer to the native copy of <var>s</var> to <var>byteArr</var> at
+     * <var>offset</var>, copying <var>s</var> to native memory if it is not yet in this arena.
+     */
+    void copyInto(String s, byte[] byteArr, int offset)
+    {
+        Integer slot = slots.get(s);
+        if (slot == null)
+        {
+            if ((count + 1) * wordSize > pointers.length)
+            {
+                pointers = Arrays.copyOf(pointers, 2 * pointers.length);
+            }
+            HDFNativeData.compoundCpyVLStr(s, pointers, count * wordSize);
+            slot = count++;
+            slots.put(s, slot);
+        }
+        System.arraycopy(pointers, slot * wordSize, byteArr, offset, wordSize);
+    }
+
+    /**
+     * Returns the number of distinct strings held in native memory.
+     */
+    int size()
+    {
+        return count;
+    }
+
+    /**
+     * Frees all native strings of this arena. The arena can be re-used afterwards. All record
+     * buffers that point into this arena become invalid.
+     */
+    void release()
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        try
+        {
+            final byte[] usedPointers =
+                    (count * wordSize == pointers.length) ? pointers : Arrays.copyOf(pointers,
+                            count * wordSize);
+            HDFNativeData.freeCompoundVLStr(usedPointers, wordSize, new int[]
+                { 0 });
+        } finally
+        {
+            slots.clear();
+            count = 0;
+        }
+    }
+
+}
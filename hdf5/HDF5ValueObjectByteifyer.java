@@ -151,31 +151,27 @@ class HDF5ValueObjectByteifyer<T>
      *        pre-defined size.
      */
     public byte[] byteify(int compoundDataTypeId, T[] arr) throws HDF5JavaException
+    {
+        return byteify(compoundDataTypeId, arr, null);
+    }
+
+    /**
+     * Byteifies <var>arr</var>, taking the native memory of the variable-length members from
+     * <var>arenaOrNull</var>. If <var>arenaOrNull</var> is not <code>null</code>, the returned
+     * array must not be reclaimed, the arena needs to be released instead.
+     * 
+     * @throw {@link HDF5JavaException} if one of the elements in <var>arr</var> exceeding its
+     *        pre-defined size.
+     */
+    public byte[] byteify(int compoundDataTypeId, T[] arr, HDF5VLStringArena arenaOrNull)
+            throws HDF5JavaException
     {
         final byte[] barray = new byte[arr.length * recordSizeInMemory];
         int offset = 0;
         int counter = 0;
         for (Object obj : arr)
         {
-            for (HDF5MemberByteifyer byteifyer : byteifyers)
-            {
-                try
-                {
-                    final byte[] b = byteifyer.byteify(compoundDataTypeId, obj);
-                    if (b.length > byteifyer.getSize() && byteifyer.mayBeCut() == false)
-                    {
-                        throw new HDF5JavaException("Compound " + byteifyer.describe()
-                                + " of array element " + counter + " must not exceed "
-                                + byteifyer.getSize() + " bytes, but is of size " + b.length
-                                + " bytes.");
-                    }
-                    System.arraycopy(b, 0, barray, offset + byteifyer.getOffsetInMemory(),
-                            Math.min(b.length, byteifyer.getSize()));
-                } catch (IllegalAccessException ex)
-                {
-                    throw new HDF5JavaException("Error accessing " + byteifyer.describe());
-                }
-            }
+            byteifyRecord(compoundDataTypeId, obj, barray, offset, counter, arenaOrNull);
             offset += recordSizeInMemory;
             ++counter;
         }
@@ -188,25 +184,66 @@ class HDF5ValueObjectByteifyer<T>
     public byte[] byteify(int compoundDataTypeId, T obj) throws HDF5JavaException
     {
         final byte[] barray = new byte[recordSizeInMemory];
+        byteifyRecord(compoundDataTypeId, obj, barray, 0, -1, null);
+        return barray;
+    }
+
+    /**
+     * Byteifies <var>obj</var> into <var>byteArr</var>, starting at <var>arrayOffset</var>. The
+     * record region is cleared first, so <var>byteArr</var> may be re-used for subsequent records.
+     * 
+     * @throw {@link HDF5JavaException} if <var>obj</var> exceeding its pre-defined size.
+     */
+    public void byteify(int compoundDataTypeId, T obj, byte[] byteArr, int arrayOffset)
+            throws HDF5JavaException
+    {
+        byteify(compoundDataTypeId, obj, byteArr, arrayOffset, null);
+    }
+
+    /**
+     * Byteifies <var>obj</var> into <var>byteArr</var>, starting at <var>arrayOffset</var>, taking
+     * the native memory of the variable-length members from <var>arenaOrNull</var>.
+     * 
+     * @throw {@link HDF5JavaException} if <var>obj</var> exceeding its pre-defined size.
+     */
+    public void byteify(int compoundDataTypeId, T obj, byte[] byteArr, int arrayOffset,
+            HDF5VLStringArena arenaOrNull) throws HDF5JavaException
+    {
+        Arrays.fill(byteArr, arrayOffset, arrayOffset + recordSizeInMemory, (byte) 0);
+        byteifyRecord(compoundDataTypeId, obj, byteArr, arrayOffset, -1, arenaOrNull);
+    }
+
+    private void byteifyRecord(int compoundDataTypeId, Object obj, byte[] barray, int offset,
+            int elementIndexOrMinusOne, HDF5VLStringArena arenaOrNull) throws HDF5JavaException
+    {
         for (HDF5MemberByteifyer byteifyer : byteifyers)
         {
             try
             {
+                if (byteifyer.byteifyInto(compoundDataTypeId, obj, barray, offset))
+                {
+                    continue;
+                }
+                if (arenaOrNull != null && byteifyer.byteifyInto(obj, barray, offset, arenaOrNull))
+                {
+                    continue;
+                }
                 final byte[] b = byteifyer.byteify(compoundDataTypeId, obj);
                 if (b.length > byteifyer.getSize() && byteifyer.mayBeCut() == false)
                 {
                     throw new HDF5JavaException("Compound " + byteifyer.describe()
-                            + " must not exceed " + byteifyer.getSize() + " bytes, but is of size "
-                            + b.length + " bytes.");
+                            + ((elementIndexOrMinusOne < 0) ? "" : " of array element "
+                                    + elementIndexOrMinusOne) + " must not exceed "
+                            + byteifyer.getSize() + " bytes, but is of size " + b.length
+                            + " bytes.");
                 }
-                System.arraycopy(b, 0, barray, byteifyer.getOffsetInMemory(),
+                System.arraycopy(b, 0, barray, offset + byteifyer.getOffsetInMemory(),
                         Math.min(b.length, byteifyer.getSize()));
             } catch (IllegalAccessException ex)
             {
                 throw new HDF5JavaException("Error accessing " + byteifyer.describe());
             }
         }
-        return barray;
     }
 
     public T[] arrayify(int compoundDataTypeId, byte[] byteArr, Class<T> recordClass)
@@ -350,6 +387,15 @@ class HDF5ValueObjectByteifyer<T>
         return vlMemberIndices;
     }
 
+    /**
+     * Returns a new arena for the variable-length members of this byteifyer, or <code>null</code>,
+     * if it has no variable-length members.
+     */
+    HDF5VLStringArena tryCreateVLStringArena()
+    {
+        return hasVLMembers() ? new HDF5VLStringArena() : null;
+    }
+
     //
     // Object
     //
@@ -0,0 +1,552 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5;
+
+import static ch.systemsx.cisd.hdf5.hdf5lib.H5D.H5Dwrite;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5P_DEFAULT;
+
+import java.io.Flushable;
+import java.lang.reflect.Array;
+import java.util.ArrayList;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.Map;
+
+import ncsa.hdf.hdf5lib.exceptions.HDF5JavaException;
+
+import ch.systemsx.cisd.hdf5.cleanup.ICallableWithCleanUp;
+import ch.systemsx.cisd.hdf5.cleanup.ICleanUpRegistry;
+
+/**
+ * Write-behind buffers for small blocks written to one-dimensional data sets with
+ * <code>writeArrayBlockWithOffset()</code>.
+ * <p>
+ * Blocks that are smaller than the buffer size are collected per data set as long as each block
+ * starts where the previous one ended, and written as one block when the buffer is full, when a
+ * block is not adjacent, when the data set is accessed by another operation of the writer, and
+ * when the writer is flushed or closed. For a chunked data set, the buffer ends on a chunk
+ * boundary and is written split at chunk boundaries, so that whole chunks are written in one go.
+ * When a buffer is written beyond the end of a chunked data set, the data set is extended to
+ * twice its size (or more, if needed) rather than to the end of the block, so that appending does
+ * not change the extent on every write. The extent is trimmed back to the end of the data written
+ * when the data set is accessed by another operation of the writer and when the writer is flushed
+ * or closed.
+ * <p>
+ * As the buffers are kept in the writer, buffered data are not visible to other readers of the
+ * file before the writer is flushed.
+ * <p>
+ * A buffer is kept until it has been written successfully. A buffer that fails to be written when
+ * another data set is accessed is written again on the next flush, and the failure is reported by
+ * {@link #flush()}, if it persists.
+ *
+ * @author Bernd Rinn
+ */
+final class HDF5WriteBehindBuffers implements Flushable
+{
+
+    /**
+     * The buffer size that makes each buffer hold one chunk of its data set.
+     */
+    static final int CHUNK_SIZE = -1;
+
+    /**
+     * The buffer size of data sets that are not chunked when the buffer size is
+     * {@link #CHUNK_SIZE}.
+     */
+    private static final int DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+    /**
+     * The buffer of one data set.
+     */
+    private static final class Buffer
+    {
+        private final String objectPath;
+
+        private final int memoryTypeId;
+
+        private final Object data;
+
+        private final long offset;
+
+        /** The number of elements of a chunk of the data set, or 0, if it is not chunked. */
+        private final long chunkSize;
+
+        private int size;
+
+        Buffer(String objectPath, int memoryTypeId, Class<?> componentType, int capacity,
+                long offset, long chunkSize)
+        {
+            this.objectPath = objectPath;
+            this.memoryTypeId = memoryTypeId;
+            this.data = Array.newInstance(componentType, capacity);
+            this.offset = offset;
+            this.chunkSize = chunkSize;
+        }
+
+        boolean isAdjacent(int blockMemoryTypeId, Object block, long blockOffset)
+        {
+            return memoryTypeId == blockMemoryTypeId
+                    && data.getClass() == block.getClass() && offset + size == blockOffset;
+        }
+
+        boolean fits(int blockSize)
+        {
+            return size + blockSize <= Array.getLength(data);
+        }
+
+        boolean isFull()
+        {
+            return size == Array.getLength(data);
+        }
+
+        void append(Object block, int blockSize)
+        {
+            System.arraycopy(block, 0, data, size, blockSize);
+            size += blockSize;
+        }
+
+        /**
+         * Returns the elements <var>start</var> (inclusive) to <var>end</var> (exclusive) of the
+         * buffered data.
+         */
+        Object getData(int start, int end)
+        {
+            if (start == 0 && end == Array.getLength(data))
+            {
+                return data;
+            }
+            final Object trimmedData =
+                    Array.newInstance(data.getClass().getComponentType(), end - start);
+            System.arraycopy(data, start, trimmedData, 0, end - start);
+            return trimmedData;
+        }
+    }
+
+    private final HDF5BaseWriter baseWriter;
+
+    private final int bufferSize;
+
+    private final Map<String, Buffer> buffers = new LinkedHashMap<String, Buffer>();
+
+    /**
+     * The number of elements written to data sets that have been extended beyond it.
+     */
+    private final Map<String, Long> writtenSizes = new LinkedHashMap<String, Long>();
+
+    /**
+     * Set while the buffers access the file themselves, so that these accesses do not write or
+     * trim the data set they are working on.
+     */
+    private boolean busy;
+
+    /**
+     * Creates write-behind buffers of <var>bufferSize</var> bytes for <var>baseWriter</var>.
+     *
+     * @param bufferSize The size of the buffers in bytes, or {@link #CHUNK_SIZE} to buffer one
+     *            chunk of each data set.
+     */
+    HDF5WriteBehindBuffers(HDF5BaseWriter baseWriter, int bufferSize)
+    {
+        if (bufferSize < 1 && bufferSize != CHUNK_SIZE)
+        {
+            throw new IllegalArgumentException("Buffer size needs to be >= 1, found: "
+                    + bufferSize);
+        }
+        this.baseWriter = baseWriter;
+        this.bufferSize = bufferSize;
+    }
+
+    /**
+     * Buffers <var>dataSize</var> elements of <var>data</var> that go to <var>offset</var> of the
+     * one-dimensional data set <var>objectPath</var>.
+     *
+     * @param memoryTypeId The memory data type of <var>data</var>.
+     * @param data A primitive array.
+     * @return <code>true</code>, if the block has been buffered or written, <code>false</code>, if
+     *         the block is too large to be buffered and the caller needs to write it.
+     */
+    synchronized boolean tryWrite(String objectPath, int memoryTypeId, Object data,
+            int dataSize, long offset)
+    {
+        final int elementSize = getElementSize(data);
+        if (bufferSize != CHUNK_SIZE && (long) dataSize * elementSize >= bufferSize)
+        {
+            return false;
+        }
+        Buffer buffer = buffers.get(objectPath);
+        if (buffer != null
+                && (buffer.isAdjacent(memoryTypeId, data, offset) == false || buffer
+                        .fits(dataSize) == false))
+        {
+            write(buffer);
+            buffers.remove(objectPath);
+            buffer = null;
+        }
+        if (buffer == null)
+        {
+            final long chunkSize = getChunkSize(objectPath);
+            final int minCapacity = getMinCapacity(chunkSize, elementSize);
+            if (dataSize >= minCapacity)
+            {
+                return false;
+            }
+            buffer =
+                    new Buffer(objectPath, memoryTypeId, data.getClass().getComponentType(),
+                            getCapacity(offset, minCapacity, chunkSize), offset, chunkSize);
+            buffers.put(objectPath, buffer);
+        }
+        buffer.append(data, dataSize);
+        if (buffer.isFull())
+        {
+            write(buffer);
+            buffers.remove(objectPath);
+        }
+        return true;
+    }
+
+    /**
+     * Writes all buffers and trims the data sets that have been extended ahead of the data.
+     *
+     * @throws RuntimeException If a buffer could not be written or a data set could not be
+     *             trimmed. The buffers that could not be written are kept.
+     */
+    @Override
+    public synchronized void flush()
+    {
+        flush("/", true);
+    }
+
+    /**
+     * Writes the buffers of the data set <var>objectPath</var> and of all data sets below it, if
+     * it is a group, and trims them if they have been extended ahead of the data. Needs to be
+     * called before the object <var>objectPath</var> is accessed by any other operation.
+     * <p>
+     * Only failures concerning the data set <var>objectPath</var> itself are thrown. The buffers
+     * of other data sets that could not be written are kept for the next flush.
+     */
+    synchronized void flush(String objectPath)
+    {
+        flush(objectPath, false);
+    }
+
+    private void flush(String objectPath, boolean reportAll)
+    {
+        if (busy || (buffers.isEmpty() && writtenSizes.isEmpty()))
+        {
+            return;
+        }
+        RuntimeException failureOrNull = null;
+        for (Buffer buffer : new ArrayList<Buffer>(buffers.values()))
+        {
+            if (isAtOrBelow(buffer.objectPath, objectPath) == false)
+            {
+                continue;
+            }
+            try
+            {
+                write(buffer);
+                buffers.remove(buffer.objectPath);
+            } catch (RuntimeException ex)
+            {
+                if (failureOrNull == null && (reportAll || buffer.objectPath.equals(objectPath)))
+                {
+                    failureOrNull = ex;
+                }
+            }
+        }
+        final RuntimeException trimFailureOrNull = trim(objectPath, reportAll);
+        if (failureOrNull != null)
+        {
+            throw failureOrNull;
+        }
+        if (trimFailureOrNull != null)
+        {
+            throw trimFailureOrNull;
+        }
+    }
+
+    private static boolean isAtOrBelow(String path, String objectPath)
+    {
+        if ("/".equals(objectPath) || path.equals(objectPath))
+        {
+            return true;
+        }
+        final String prefix = objectPath.endsWith("/") ? objectPath : objectPath + "/";
+        return path.startsWith(prefix);
+    }
+
+    /**
+     * Returns the number of elements of a chunk of the data set <var>objectPath</var>, or 0, if
+     * it is not a chunked data set of rank 1.
+     */
+    private long getChunkSize(final String objectPath)
+    {
+        final ICallableWithCleanUp<Long> getChunkSizeRunnable = new ICallableWithCleanUp<Long>()
+            {
+                @Override
+                public Long call(final ICleanUpRegistry registry)
+                {
+                    final int dataSetId =
+                            baseWriter.h5.openDataSet(baseWriter.fileId, objectPath, registry);
+                    final long[] chunkDimensionsOrNull =
+                            baseWriter.h5.tryGetChunkDimensions(dataSetId, registry);
+                    return (chunkDimensionsOrNull != null && chunkDimensionsOrNull.length == 1)
+                            ? chunkDimensionsOrNull[0] : 0L;
+                }
+            };
+        return callBusy(getChunkSizeRunnable);
+    }
+
+    /**
+     * Returns the number of elements that a buffer needs to be able to hold at least.
+     */
+    private int getMinCapacity(long chunkSize, int elementSize)
+    {
+        if (bufferSize != CHUNK_SIZE)
+        {
+            return bufferSize / elementSize;
+        }
+        if (chunkSize > 0)
+        {
+            return (int) Math.min(chunkSize, Integer.MAX_VALUE);
+        }
+        return DEFAULT_BUFFER_SIZE / elementSize;
+    }
+
+    /**
+     * Returns the capacity of a buffer that starts at <var>offset</var>: at least
+     * <var>minCapacity</var> elements and, for a chunked data set, up to the next chunk boundary.
+     */
+    private static int getCapacity(long offset, int minCapacity, long chunkSize)
+    {
+        if (chunkSize <= 0)
+        {
+            return minCapacity;
+        }
+        final long end = ((offset + minCapacity + chunkSize - 1) / chunkSize) * chunkSize;
+        return (end - offset <= Integer.MAX_VALUE) ? (int) (end - offset) : minCapacity;
+    }
+
+    /**
+     * Writes <var>buffer</var>, split at chunk boundaries.
+     */
+    private void write(Buffer buffer)
+    {
+        if (buffer.chunkSize <= 0)
+        {
+            write(buffer, 0, buffer.size);
+            return;
+        }
+        final long end = buffer.offset + buffer.size;
+        final long alignedStart =
+                Math.min(end, ((buffer.offset + buffer.chunkSize - 1) / buffer.chunkSize)
+                        * buffer.chunkSize);
+        final long alignedEnd = Math.max(alignedStart, (end / buffer.chunkSize) * buffer.chunkSize);
+        int start = 0;
+        for (long boundary : new long[]
+            { alignedStart, alignedEnd, end })
+        {
+            final int stop = (int) (boundary - buffer.offset);
+            if (stop > start)
+            {
+                write(buffer, start, stop);
+                start = stop;
+            }
+        }
+    }
+
+    /**
+     * Writes the elements <var>start</var> (inclusive) to <var>end</var> (exclusive) of
+     * <var>buffer</var>.
+     */
+    private void write(final Buffer buffer, final int start, final int end)
+    {
+        final ICallableWithCleanUp<Void> writeRunnable = new ICallableWithCleanUp<Void>()
+            {
+                @Override
+                public Void call(final ICleanUpRegistry registry)
+                {
+                    final long[] blockDimensions = new long[]
+                        { end - start };
+                    final long[] slabStart = new long[]
+                        { buffer.offset + start };
+                    final int dataSetId =
+                            baseWriter.h5.openDataSet(baseWriter.fileId, buffer.objectPath,
+                                    registry);
+                    extend(buffer.objectPath, dataSetId, buffer.offset + end, registry);
+                    final Object data = buffer.getData(start, end);
+                    if (baseWriter.tryWriteCompressedInParallel(buffer.objectPath, dataSetId,
+                            buffer.memoryTypeId, slabStart, blockDimensions, data, registry))
+                    {
+                        return null; // Nothing to return.
+                    }
+                    final int dataSpaceId =
+                            baseWriter.h5.getDataSpaceForDataSet(dataSetId, registry);
+                    baseWriter.h5.setHyperslabBlock(dataSpaceId, slabStart, blockDimensions);
+                    final int memorySpaceId =
+                            baseWriter.h5.createSimpleDataSpace(blockDimensions, registry);
+                    write(dataSetId, buffer.memoryTypeId, memorySpaceId, dataSpaceId, data);
+                    return null; // Nothing to return.
+                }
+            };
+        callBusy(writeRunnable);
+    }
+
+    /**
+     * Makes sure that the data set <var>dataSetId</var> has at least <var>end</var> elements. A
+     * chunked data set is extended geometrically, remembering the number of elements written.
+     */
+    private void extend(String objectPath, int dataSetId, long end, ICleanUpRegistry registry)
+    {
+        final long[] dimensions = baseWriter.h5.getDataDimensions(dataSetId, registry);
+        if (dimensions.length != 1)
+        {
+            throw new HDF5JavaException("Data set " + objectPath
+                    + " is expected to be of rank 1 (rank=" + dimensions.length + ")");
+        }
+        final Long writtenSizeOrNull = writtenSizes.get(objectPath);
+        if (end <= dimensions[0])
+        {
+            if (writtenSizeOrNull != null && end > writtenSizeOrNull)
+            {
+                writtenSizes.put(objectPath, end);
+            }
+            return;
+        }
+        final HDF5StorageLayout layout = baseWriter.h5.getLayout(dataSetId, registry);
+        final boolean chunked = (layout == HDF5StorageLayout.CHUNKED);
+        baseWriter.h5.extendDataSet(baseWriter.fileId, dataSetId, layout, dimensions, new long[]
+            { chunked ? Math.max(end, 2 * dimensions[0]) : end }, null, -1, registry);
+        if (chunked)
+        {
+            writtenSizes.put(objectPath, end);
+        }
+    }
+
+    /**
+     * Trims the data sets at or below <var>objectPath</var> to the end of the data written. The
+     * data sets that fail to be trimmed are kept for the next flush.
+     *
+     * @return The first failure to report, or <code>null</code>, if there is none.
+     */
+    private RuntimeException trim(final String objectPath, final boolean reportAll)
+    {
+        if (writtenSizes.isEmpty())
+        {
+            return null;
+        }
+        final ICallableWithCleanUp<RuntimeException> trimRunnable =
+                new ICallableWithCleanUp<RuntimeException>()
+                    {
+                        @Override
+                        public RuntimeException call(final ICleanUpRegistry registry)
+                        {
+                            RuntimeException failureOrNull = null;
+                            for (Iterator<Map.Entry<String, Long>> it =
+                                    writtenSizes.entrySet().iterator(); it.hasNext();)
+                            {
+                                final Map.Entry<String, Long> entry = it.next();
+                                if (isAtOrBelow(entry.getKey(), objectPath) == false)
+                                {
+                                    continue;
+                                }
+                                try
+                                {
+                                    final int dataSetId =
+                                            baseWriter.h5.openDataSet(baseWriter.fileId,
+                                                    entry.getKey(), registry);
+                                    baseWriter.h5.setDataSetExtentChunked(dataSetId, new long[]
+                                        { entry.getValue() });
+                                    it.remove();
+                                } catch (RuntimeException ex)
+                                {
+                                    if (failureOrNull == null
+                                            && (reportAll || entry.getKey().equals(objectPath)))
+                                    {
+                                        failureOrNull = ex;
+                                    }
+                                }
+                            }
+                            return failureOrNull;
+                        }
+                    };
+        return callBusy(trimRunnable);
+    }
+
+    private <T> T callBusy(ICallableWithCleanUp<T> callable)
+    {
+        final boolean wasBusy = busy;
+        busy = true;
+        try
+        {
+            return baseWriter.runner.call(callable);
+        } finally
+        {
+            busy = wasBusy;
+        }
+    }
+
+    private static void write(int dataSetId, int memoryTypeId, int memorySpaceId,
+            int dataSpaceId, Object data)
+    {
+        if (data instanceof byte[])
+        {
+            H5Dwrite(dataSetId, memoryTypeId, memorySpaceId, dataSpaceId, H5P_DEFAULT,
+                    (byte[]) data);
+        } else if (data instanceof short[])
+        {
+            H5Dwrite(dataSetId, memoryTypeId, memorySpaceId, dataSpaceId, H5P_DEFAULT,
+                    (short[]) data);
+        } else if (data instanceof int[])
+        {
+            H5Dwrite(dataSetId, memoryTypeId, memorySpaceId, dataSpaceId, H5P_DEFAULT,
+                    (int[]) data);
+        } else if (data instanceof long[])
+        {
+            H5Dwrite(dataSetId, memoryTypeId, memorySpaceId, dataSpaceId, H5P_DEFAULT,
+                    (long[]) data);
+        } else if (data instanceof float[])
+        {
+            H5Dwrite(dataSetId, memoryTypeId, memorySpaceId, dataSpaceId, H5P_DEFAULT,
+                    (float[]) data);
+        } else
+        {
+            H5Dwrite(dataSetId, memoryTypeId, memorySpaceId, dataSpaceId, H5P_DEFAULT,
+                    (double[]) data);
+        }
+    }
+
+    private static int getElementSize(Object data)
+    {
+        if (data instanceof byte[])
+        {
+            return 1;
+        } else if (data instanceof short[])
+        {
+            return 2;
+        } else if (data instanceof int[] || data instanceof float[])
+        {
+            return 4;
+        } else if (data instanceof long[] || data instanceof double[])
+        {
+            return 8;
+        }
+        throw new IllegalArgumentException("Unsupported data type "
+                + data.getClass().getSimpleName());
+    }
+
+}
@@ -42,6 +42,22 @@ final class HDF5WriterConfigurator extends HDF5ReaderConfigurator implements
 
     private String houseKeepingNameSuffix = "";
 
+    private int numberOfCompressionThreads = 0;
+
+    private int writeBehindBufferSize = 0;
+
+    private long smallDataBlockSize = -1;
+
+    private long alignmentThreshold = -1;
+
+    private long alignment = -1;
+
+    private long metaBlockSize = -1;
+
+    private int inMemoryIncrement = -1;
+
+    private boolean backingStore = false;
+
     // For Windows, use a blocking sync mode by default as otherwise the mandatory locks are up for
     // some surprises after the file has been closed.
     private SyncMode syncMode = OSUtilities.isWindows() ? SyncMode.SYNC_ON_FLUSH_BLOCK
@@ -120,6 +136,104 @@ final class HDF5WriterConfigurator extends HDF5ReaderConfigurator implements
         return (HDF5WriterConfigurator) super.noAutoDereference();
     }
 
+    @Override
+    public HDF5WriterConfigurator chunkCache(HDF5ChunkCacheParameters chunkCache)
+    {
+        return (HDF5WriterConfigurator) super.chunkCache(chunkCache);
+    }
+
+    @Override
+    public HDF5WriterConfigurator metaDataCacheSize(long size)
+    {
+        return (HDF5WriterConfigurator) super.metaDataCacheSize(size);
+    }
+
+    @Override
+    public HDF5WriterConfigurator convertCompoundsInJava()
+    {
+        return (HDF5WriterConfigurator) super.convertCompoundsInJava();
+    }
+
+    @Override
+    public HDF5WriterConfigurator parallelCompression(int numberOfThreads)
+    {
+        if (numberOfThreads < 1)
+        {
+            throw new IllegalArgumentException("Number of threads needs to be >= 1, found: "
+                    + numberOfThreads);
+        }
+        this.numberOfCompressionThreads = numberOfThreads;
+        return this;
+    }
+
+    @Override
+    public HDF5WriterConfigurator writeBehindBuffering(int bufferSize)
+    {
+        if (bufferSize < 1)
+        {
+            throw new IllegalArgumentException("Buffer size needs to be >= 1, found: "
+                    + bufferSize);
+        }
+        this.writeBehindBufferSize = bufferSize;
+        return this;
+    }
+
+    @Override
+    public HDF5WriterConfigurator writeBehindBuffering()
+    {
+        this.writeBehindBufferSize = HDF5WriteBehindBuffers.CHUNK_SIZE;
+        return this;
+    }
+
+    @Override
+    public HDF5WriterConfigurator smallDataBlockSize(long size)
+    {
+        if (size < 0)
+        {
+            throw new IllegalArgumentException("Small data block size needs to be >= 0, found: "
+                    + size);
+        }
+        this.smallDataBlockSize = size;
+        return this;
+    }
+
+    @Override
+    public HDF5WriterConfigurator alignment(long threshold, long alignment)
+    {
+        if (threshold < 0 || alignment < 1)
+        {
+            throw new IllegalArgumentException("Alignment threshold needs to be >= 0 and "
+                    + "alignment needs to be >= 1, found: " + threshold + ", " + alignment);
+        }
+        this.alignmentThreshold = threshold;
+        this.alignment = alignment;
+        return this;
+    }
+
+    @Override
+    public HDF5WriterConfigurator metaBlockSize(long size)
+    {
+        if (size < 0)
+        {
+            throw new IllegalArgumentException("Metadata block size needs to be >= 0, found: "
+                    + size);
+        }
+        this.metaBlockSize = size;
+        return this;
+    }
+
+    @Override
+    public HDF5WriterConfigurator inMemory(int increment, boolean backingStore)
+    {
+        if (increment < 1)
+        {
+            throw new IllegalArgumentException("Increment needs to be >= 1, found: " + increment);
+        }
+        this.inMemoryIncrement = increment;
+        this.backingStore = backingStore;
+        return this;
+    }
+
     @Override
     public IHDF5Writer writer()
     {
@@ -129,7 +243,12 @@ final class HDF5WriterConfigurator extends HDF5ReaderConfigurator implements
                     new HDF5Writer(new HDF5BaseWriter(hdf5File, performNumericConversions,
                             useUTF8CharEncoding, autoDereference, fileFormat,
                             useExtentableDataTypes, overwriteFile, keepDataSetIfExists,
-                            useSimpleDataSpaceForAttributes, houseKeepingNameSuffix, syncMode));
+                            useSimpleDataSpaceForAttributes, houseKeepingNameSuffix, syncMode,
+                            chunkCacheOrNull, new HDF5FileAccessParameters(smallDataBlockSize,
+                                    alignmentThreshold, alignment, metaBlockSize,
+                                    metaDataCacheSize, inMemoryIncrement, backingStore),
+                            convertCompoundsInJava,
+                            numberOfCompressionThreads, writeBehindBufferSize));
         }
         return (HDF5Writer) readerWriterOrNull;
     }
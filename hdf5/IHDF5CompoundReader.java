@@ -298,6 +298,106 @@ public interface IHDF5CompoundReader extends IHDF5CompoundInformationRetriever
     public <T> Iterable<HDF5DataBlock<T[]>> getArrayBlocks(String objectPath, Class<T> pojoClass)
             throws HDF5JavaException;
 
+    /**
+     * Reads the members <var>memberNames</var> of the one-dimensional compound data set
+     * <var>objectPath</var> into one primitive or <code>String</code> array per member.
+     * <p>
+     * Only the selected members are transferred from the file and no object is created per record,
+     * which makes this method considerably faster than {@link #readArray(String, Class)} if only a
+     * few members of a wide compound are needed. Supported members are integers, floats and
+     * (fixed-length or variable-length) strings.
+     *
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param memberNames The names of the compound members to read.
+     * @return The columns read from the data set.
+     * @throws HDF5JavaException If the data set is not a compound data set, if one of the members
+     *             does not exist or has a type that is not supported for columnar reading.
+     */
+    public HDF5CompoundColumns readColumns(String objectPath, String... memberNames)
+            throws HDF5JavaException;
+
+    /**
+     * Reads a block of the members <var>memberNames</var> of the one-dimensional compound data set
+     * <var>objectPath</var> into one primitive or <code>String</code> array per member.
+     *
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param blockSize The block size (this will be the length of the columns returned if the data
+     *            set is long enough).
+     * @param blockNumber The number of the block to read (starting with 0, offset: multiply with
+     *            <var>blockSize</var>).
+     * @param memberNames The names of the compound members to read.
+     * @return The columns read from the data set.
+     * @throws HDF5JavaException If the data set is not a compound data set, if one of the members
+     *             does not exist or has a type that is not supported for columnar reading.
+     * @see #readColumns(String, String...)
+     */
+    public HDF5CompoundColumns readColumnsBlock(String objectPath, int blockSize,
+            long blockNumber, String... memberNames) throws HDF5JavaException;
+
+    /**
+     * Reads a block of the members <var>memberNames</var> of the one-dimensional compound data set
+     * <var>objectPath</var> into one primitive or <code>String</code> array per member.
+     *
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param blockSize The block size (this will be the length of the columns returned if the data
+     *            set is long enough).
+     * @param offset The offset of the block to read (starting with 0).
+     * @param memberNames The names of the compound members to read.
+     * @return The columns read from the data set.
+     * @throws HDF5JavaException If the data set is not a compound data set, if one of the members
+     *             does not exist or has a type that is not supported for columnar reading.
+     * @see #readColumns(String, String...)
+     */
+    public HDF5CompoundColumns readColumnsBlockWithOffset(String objectPath, int blockSize,
+            long offset, String... memberNames) throws HDF5JavaException;
+
+    /**
+     * Provides all natural blocks of the members <var>memberNames</var> of this one-dimensional
+     * data set of compounds to iterate over, column by column.
+     *
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param memberNames The names of the compound members to read.
+     * @see HDF5DataBlock
+     * @see #readColumns(String, String...)
+     * @throws HDF5JavaException If the data set is not of rank 1 or not a compound data set.
+     */
+    public Iterable<HDF5DataBlock<HDF5CompoundColumns>> getColumnBlocks(String objectPath,
+            String... memberNames) throws HDF5JavaException;
+
+    /**
+     * Returns a cursor over the records of the one-dimensional compound data set
+     * <var>objectPath</var>, reading {@link HDF5CompoundCursor#DEFAULT_BLOCK_SIZE} records at a
+     * time.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param type The type definition of this compound type.
+     * @throws HDF5JavaException If the data set is not of rank 1 or not a compound data set.
+     */
+    public HDF5CompoundCursor getCursor(String objectPath, HDF5CompoundType<?> type)
+            throws HDF5JavaException;
+
+    /**
+     * Returns a cursor over the records of the one-dimensional compound data set
+     * <var>objectPath</var>.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param type The type definition of this compound type.
+     * @param blockSize The number of records to read at a time.
+     * @throws HDF5JavaException If the data set is not of rank 1 or not a compound data set.
+     */
+    public HDF5CompoundCursor getCursor(String objectPath, HDF5CompoundType<?> type,
+            int blockSize) throws HDF5JavaException;
+
+    /**
+     * Returns a cursor over all members of the records of the one-dimensional compound data set
+     * <var>objectPath</var>, reading {@link HDF5CompoundCursor#DEFAULT_BLOCK_SIZE} records at a
+     * time.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @throws HDF5JavaException If the data set is not of rank 1 or not a compound data set.
+     */
+    public HDF5CompoundCursor getCursor(String objectPath) throws HDF5JavaException;
+
     /**
      * Reads a compound array from the data set <var>objectPath</var>.
      * 
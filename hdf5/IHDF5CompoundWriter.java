@@ -18,6 +18,8 @@ package ch.systemsx.cisd.hdf5;
 
 import java.util.List;
 
+import ncsa.hdf.hdf5lib.exceptions.HDF5JavaException;
+
 import ch.systemsx.cisd.base.mdarray.MDArray;
 
 /**
@@ -394,6 +396,55 @@ public interface IHDF5CompoundWriter extends IHDF5CompoundReader
     public <T> void writeArrayBlockWithOffset(String objectPath, HDF5CompoundType<T> type,
             T[] data, long offset, IByteArrayInspector inspectorOrNull);
 
+    /**
+     * Returns an appender for records to the end of the array (of rank 1) of compound values
+     * <var>objectPath</var>, using {@link HDF5CompoundAppender#DEFAULT_BATCH_SIZE} and
+     * {@link HDF5CompoundAppender#DEFAULT_MAX_DELAY_MILLIS}. If the data set does not yet exist,
+     * it is created as an extendable data set with a chunk size of the batch size.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param type The type definition of this compound type.
+     * @throws HDF5JavaException If the data set exists and is not an extendable data set of rank 1.
+     */
+    public <T> HDF5CompoundAppender<T> getAppender(String objectPath, HDF5CompoundType<T> type)
+            throws HDF5JavaException;
+
+    /**
+     * Returns an appender for records to the end of the array (of rank 1) of compound values
+     * <var>objectPath</var>. If the data set does not yet exist, it is created as an extendable
+     * data set with a chunk size of <var>batchSize</var>.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param type The type definition of this compound type.
+     * @param batchSize The number of records to buffer before writing them as one block.
+     * @param maxDelayMillis The time in milliseconds after which the buffered records are written
+     *            on the next append. It is only checked when a record is appended, so records
+     *            are kept until the appender or the writer is flushed or closed if no more
+     *            records come in.
+     * @throws HDF5JavaException If the data set exists and is not an extendable data set of rank 1.
+     */
+    public <T> HDF5CompoundAppender<T> getAppender(String objectPath, HDF5CompoundType<T> type,
+            int batchSize, long maxDelayMillis) throws HDF5JavaException;
+
+    /**
+     * Returns an appender for records to the end of the array (of rank 1) of compound values
+     * <var>objectPath</var>. If the data set does not yet exist, it is created as an extendable
+     * data set with <var>features</var> and a chunk size of <var>batchSize</var>.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param type The type definition of this compound type.
+     * @param features The storage features of the data set, if it needs to be created.
+     * @param batchSize The number of records to buffer before writing them as one block.
+     * @param maxDelayMillis The time in milliseconds after which the buffered records are written
+     *            on the next append. It is only checked when a record is appended, so records
+     *            are kept until the appender or the writer is flushed or closed if no more
+     *            records come in.
+     * @throws HDF5JavaException If the data set exists and is not an extendable data set of rank 1.
+     */
+    public <T> HDF5CompoundAppender<T> getAppender(String objectPath, HDF5CompoundType<T> type,
+            HDF5GenericStorageFeatures features, int batchSize, long maxDelayMillis)
+            throws HDF5JavaException;
+
     /**
      * Creates an array (of rank 1) of compound values.
      * 
@@ -16,6 +16,8 @@
 
 package ch.systemsx.cisd.hdf5;
 
+import java.nio.DoubleBuffer;
+
 import ncsa.hdf.hdf5lib.exceptions.HDF5JavaException;
 
 import ch.systemsx.cisd.base.mdarray.MDDoubleArray;
@@ -192,6 +194,65 @@ public interface IHDF5DoubleReader
     public double[] readArrayBlockWithOffset(HDF5DataSet dataSet, int blockSize,
             long offset);
 
+    /**
+     * Reads a block from <code>double</code> array (of rank 1) from the data set
+     * <var>objectPath</var> into <var>buffer</var>, without allocating a new array.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param buffer The buffer to read the values in.
+     * @param blockSize The block size in numbers of elements.
+     * @param offset The offset of the block in the data set (starting with 0).
+     * @param memoryOffset The offset of the block in <var>buffer</var> (starting with 0).
+     * @return The effective block size, which is less than <var>blockSize</var> if the data set
+     *         ends before.
+     * @throws HDF5JavaException If the data set is not of rank 1 or if <var>buffer</var> is not
+     *             large enough for <var>blockSize</var> and <var>memoryOffset</var>.
+     */
+    public int readArrayToBlockWithOffset(String objectPath, double[] buffer, int blockSize,
+            long offset, int memoryOffset) throws HDF5JavaException;
+
+    /**
+     * Reads a block from <code>double</code> array (of rank 1) from the <var>dataSet</var> into
+     * <var>buffer</var>, without allocating a new array.
+     * <p>
+     * <i>This method is faster than
+     * {@link #readArrayToBlockWithOffset(String, double[], int, long, int)} when called many times
+     * on the same data set.</i>
+     * 
+     * @param dataSet The data set object in the file which has been created by using
+                  {@link IHDF5ObjectReadOnlyInfoProviderHandler#openDataSet}.
+     * @param buffer The buffer to read the values in.
+     * @param blockSize The block size in numbers of elements.
+     * @param offset The offset of the block in the data set (starting with 0).
+     * @param memoryOffset The offset of the block in <var>buffer</var> (starting with 0).
+     * @return The effective block size, which is less than <var>blockSize</var> if the data set
+     *         ends before.
+     * @throws HDF5JavaException If the data set is not of rank 1 or if <var>buffer</var> is not
+     *             large enough for <var>blockSize</var> and <var>memoryOffset</var>.
+     */
+    public int readArrayToBlockWithOffset(HDF5DataSet dataSet, double[] buffer, int blockSize,
+            long offset, int memoryOffset) throws HDF5JavaException;
+
+    /**
+     * Reads a block from <code>double</code> array (of rank 1) from the data set
+     * <var>objectPath</var> into <var>buffer</var>. The block starts at <var>offset</var> and
+     * has the length of the remaining elements of <var>buffer</var>, or less if the data set ends
+     * before. On return, the position of <var>buffer</var> is advanced by the number of elements
+     * read.
+     * <p>
+     * <i>Note: the native library shipped with this release cannot read into buffers. The data are
+     * read into a temporary Java array and then copied into <var>buffer</var>, which is one copy
+     * more than reading into an array. Only a direct buffer in native byte order is filled without
+     * the temporary array, and only if the native library supports it, see
+     * {@link ch.systemsx.cisd.hdf5.hdf5lib.H5Features#isBufferReadAvailable()}.</i>
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param offset The offset of the block in the data set to start reading from (starting with 0).
+     * @param buffer The buffer to read the data into.
+     * @return The number of elements read.
+     */
+    public int readToBuffer(String objectPath, long offset, DoubleBuffer buffer);
+
     /**
      * Reads a <code>double</code> matrix (array of arrays) from the data set
      * <var>objectPath</var>.
@@ -378,6 +439,20 @@ public interface IHDF5DoubleReader
     									String dataSetPath)
             throws HDF5JavaException;
 
+    /**
+     * Provides all natural blocks of this one-dimensional data set to iterate over.
+     * <p>
+     * If <var>reuseBuffer</var> is <code>true</code>, all blocks of the same size share one array
+     * which is overwritten by each call to {@link java.util.Iterator#next()}. Use this to avoid allocating
+     * a new array per block, but do not keep references to the data of a block beyond the next
+     * iteration step.
+     * 
+     * @see HDF5DataBlock
+     * @throws HDF5JavaException If the data set is not of rank 1.
+     */
+    public Iterable<HDF5DataBlock<double[]>> getArrayNaturalBlocks(String dataSetPath,
+            boolean reuseBuffer) throws HDF5JavaException;
+
     /**
      * Provides all natural blocks of this multi-dimensional data set to iterate over.
      * 
@@ -385,4 +460,39 @@ public interface IHDF5DoubleReader
      */
     public Iterable<HDF5MDDataBlock<MDDoubleArray>> getMDArrayNaturalBlocks(
     									String dataSetPath);
+
+    /**
+     * Provides all natural blocks of this one-dimensional data set to iterate over, reading up to
+     * <var>numberOfBlocksToPrefetch</var> blocks ahead in the background while the current block
+     * is processed.
+     * <p>
+     * The arrays of the blocks are recycled: the data of a block must not be used after the next
+     * call to {@link java.util.Iterator#next()}.
+     * <p>
+     * The iterators implement {@link java.io.Closeable}. The background reads and the resources
+     * they use are released after the last block, but an iteration that is abandoned before needs
+     * to close its iterator to cancel the reads ahead.
+     * 
+     * @see HDF5DataBlock
+     * @throws HDF5JavaException If the data set is not of rank 1.
+     */
+    public Iterable<HDF5DataBlock<double[]>> getArrayNaturalBlocksPrefetched(String dataSetPath,
+            int numberOfBlocksToPrefetch) throws HDF5JavaException;
+
+    /**
+     * Provides all natural blocks of this multi-dimensional data set to iterate over, reading up
+     * to <var>numberOfBlocksToPrefetch</var> blocks ahead in the background while the current
+     * block is processed.
+     * <p>
+     * The arrays of the blocks are recycled: the data of a block must not be used after the next
+     * call to {@link java.util.Iterator#next()}.
+     * <p>
+     * The iterators implement {@link java.io.Closeable}. The background reads and the resources
+     * they use are released after the last block, but an iteration that is abandoned before needs
+     * to close its iterator to cancel the reads ahead.
+     * 
+     * @see HDF5MDDataBlock
+     */
+    public Iterable<HDF5MDDataBlock<MDDoubleArray>> getMDArrayNaturalBlocksPrefetched(
+            String dataSetPath, int numberOfBlocksToPrefetch);
 }
@@ -344,4 +344,128 @@ public interface IHDF5EnumReader extends IHDF5EnumTypeRetriever
     public Iterable<HDF5MDEnumBlock> getMDArrayBlocks(final String objectPath)
             throws HDF5JavaException;
 
+    // /////////////////////
+    // Ordinals
+    // /////////////////////
+
+    /**
+     * Reads the ordinals of the enum array <var>objectPath</var> directly into a
+     * <code>byte</code> array, without creating an object per value. The ordinals are the ones of
+     * the enum type of the data set, see {@link #getDataSetType(String)}.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @return The ordinals read from the data set.
+     * @throws HDF5JavaException If the <var>objectPath</var> is not an enum data set or if its
+     *             storage form is wider than a <code>byte</code>.
+     */
+    public byte[] readByteOrdinalArray(final String objectPath) throws HDF5JavaException;
+
+    /**
+     * Reads the ordinals of the enum array <var>objectPath</var> directly into a
+     * <code>short</code> array, without creating an object per value. The ordinals are the ones of
+     * the enum type of the data set, see {@link #getDataSetType(String)}.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @return The ordinals read from the data set.
+     * @throws HDF5JavaException If the <var>objectPath</var> is not an enum data set or if its
+     *             storage form is wider than a <code>short</code>.
+     */
+    public short[] readShortOrdinalArray(final String objectPath) throws HDF5JavaException;
+
+    /**
+     * Reads the ordinals of the enum array <var>objectPath</var> directly into an
+     * <code>int</code> array, without creating an object per value. The ordinals are the ones of
+     * the enum type of the data set, see {@link #getDataSetType(String)}.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @return The ordinals read from the data set.
+     * @throws HDF5JavaException If the <var>objectPath</var> is not an enum data set.
+     */
+    public int[] readIntOrdinalArray(final String objectPath) throws HDF5JavaException;
+
+    /**
+     * Reads a block of the ordinals of the enum array <var>objectPath</var> directly into a
+     * <code>byte</code> array.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param blockSize The block size (this will be the length of the array returned if the data
+     *            set is long enough).
+     * @param offset The offset of the block in the data set to start reading from (starting with
+     *            0).
+     * @return The ordinals read from the data set. The length will be min(size - offset,
+     *         blockSize).
+     * @throws HDF5JavaException If the <var>objectPath</var> is not an enum data set or if its
+     *             storage form is wider than a <code>byte</code>.
+     */
+    public byte[] readByteOrdinalArrayBlockWithOffset(final String objectPath,
+            final int blockSize, final long offset) throws HDF5JavaException;
+
+    /**
+     * Reads a block of the ordinals of the enum array <var>objectPath</var> directly into a
+     * <code>short</code> array.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param blockSize The block size (this will be the length of the array returned if the data
+     *            set is long enough).
+     * @param offset The offset of the block in the data set to start reading from (starting with
+     *            0).
+     * @return The ordinals read from the data set. The length will be min(size - offset,
+     *         blockSize).
+     * @throws HDF5JavaException If the <var>objectPath</var> is not an enum data set or if its
+     *             storage form is wider than a <code>short</code>.
+     */
+    public short[] readShortOrdinalArrayBlockWithOffset(final String objectPath,
+            final int blockSize, final long offset) throws HDF5JavaException;
+
+    /**
+     * Reads a block of the ordinals of the enum array <var>objectPath</var> directly into an
+     * <code>int</code> array.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param blockSize The block size (this will be the length of the array returned if the data
+     *            set is long enough).
+     * @param offset The offset of the block in the data set to start reading from (starting with
+     *            0).
+     * @return The ordinals read from the data set. The length will be min(size - offset,
+     *         blockSize).
+     * @throws HDF5JavaException If the <var>objectPath</var> is not an enum data set.
+     */
+    public int[] readIntOrdinalArrayBlockWithOffset(final String objectPath, final int blockSize,
+            final long offset) throws HDF5JavaException;
+
+    /**
+     * Provides the ordinals of all natural blocks of this one-dimensional enum data set as
+     * <code>byte</code> arrays to iterate over.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @see HDF5DataBlock
+     * @throws HDF5JavaException If the data set is not of rank 1 or if its storage form is wider
+     *             than a <code>byte</code>.
+     */
+    public Iterable<HDF5DataBlock<byte[]>> getByteOrdinalArrayBlocks(final String objectPath)
+            throws HDF5JavaException;
+
+    /**
+     * Provides the ordinals of all natural blocks of this one-dimensional enum data set as
+     * <code>short</code> arrays to iterate over.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @see HDF5DataBlock
+     * @throws HDF5JavaException If the data set is not of rank 1 or if its storage form is wider
+     *             than a <code>short</code>.
+     */
+    public Iterable<HDF5DataBlock<short[]>> getShortOrdinalArrayBlocks(final String objectPath)
+            throws HDF5JavaException;
+
+    /**
+     * Provides the ordinals of all natural blocks of this one-dimensional enum data set as
+     * <code>int</code> arrays to iterate over.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @see HDF5DataBlock
+     * @throws HDF5JavaException If the data set is not of rank 1.
+     */
+    public Iterable<HDF5DataBlock<int[]>> getIntOrdinalArrayBlocks(final String objectPath)
+            throws HDF5JavaException;
+
 }
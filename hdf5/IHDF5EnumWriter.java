@@ -154,6 +154,57 @@ public interface IHDF5EnumWriter extends IHDF5EnumReader, IHDF5EnumValueCreator
     public void writeArray(String objectPath, HDF5EnumerationValueArray data,
             HDF5IntStorageFeatures features) throws HDF5JavaException;
 
+    /**
+     * Writes out an array of enum values given as ordinals of <var>enumType</var>. The type is
+     * committed to the file if needed. No object and no <code>String</code> is created per value.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param enumType The enumeration type that the ordinals refer to.
+     * @param ordinals The ordinals to write.
+     * @param features The storage features of the data set. Note that for scaling compression the
+     *            compression factor is ignored. Instead, the scaling factor is computed from the
+     *            number of entries in the enumeration.
+     * @return The enum type of the data set in the file.
+     * @throws IllegalArgumentException If any of the <var>ordinals</var> is outside of the range
+     *             of <var>enumType</var>.
+     */
+    public HDF5EnumerationType writeOrdinalArray(String objectPath, EnumerationType enumType,
+            byte[] ordinals, HDF5IntStorageFeatures features) throws IllegalArgumentException;
+
+    /**
+     * Writes out an array of enum values given as ordinals of <var>enumType</var>. The type is
+     * committed to the file if needed. No object and no <code>String</code> is created per value.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param enumType The enumeration type that the ordinals refer to.
+     * @param ordinals The ordinals to write.
+     * @param features The storage features of the data set. Note that for scaling compression the
+     *            compression factor is ignored. Instead, the scaling factor is computed from the
+     *            number of entries in the enumeration.
+     * @return The enum type of the data set in the file.
+     * @throws IllegalArgumentException If any of the <var>ordinals</var> is outside of the range
+     *             of <var>enumType</var>.
+     */
+    public HDF5EnumerationType writeOrdinalArray(String objectPath, EnumerationType enumType,
+            short[] ordinals, HDF5IntStorageFeatures features) throws IllegalArgumentException;
+
+    /**
+     * Writes out an array of enum values given as ordinals of <var>enumType</var>. The type is
+     * committed to the file if needed. No object and no <code>String</code> is created per value.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param enumType The enumeration type that the ordinals refer to.
+     * @param ordinals The ordinals to write.
+     * @param features The storage features of the data set. Note that for scaling compression the
+     *            compression factor is ignored. Instead, the scaling factor is computed from the
+     *            number of entries in the enumeration.
+     * @return The enum type of the data set in the file.
+     * @throws IllegalArgumentException If any of the <var>ordinals</var> is outside of the range
+     *             of <var>enumType</var>.
+     */
+    public HDF5EnumerationType writeOrdinalArray(String objectPath, EnumerationType enumType,
+            int[] ordinals, HDF5IntStorageFeatures features) throws IllegalArgumentException;
+
     /**
      * Creates am enum array (of rank 1).
      * 
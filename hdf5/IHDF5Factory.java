@@ -34,6 +34,12 @@ public interface IHDF5Factory
      */
     public IHDF5Writer open(File file);
 
+    /**
+     * Opens an HDF5 file named <var>name</var> for writing and reading that is kept in memory and
+     * discarded when the writer is closed. Nothing is read from or written to disk.
+     */
+    public IHDF5Writer openInMemory(String name);
+
     /**
      * Opens an HDF5 <var>file</var> for reading. It is an error if the file does not exist.
      */
@@ -53,6 +59,17 @@ public interface IHDF5Factory
      */
     public IHDF5ReaderConfigurator configureForReading(File file);
 
+    /**
+     * Opens a configurator for an HDF5 <var>file</var> that is kept in memory. The memory is
+     * allocated and grown in steps of <var>initialSize</var> bytes. If <var>backingStore</var> is
+     * <code>true</code>, the file is written to <var>file</var> when the writer is closed,
+     * replacing an existing file, otherwise it is discarded. Configure the writer as you need and
+     * then call {@link IHDF5WriterConfigurator#writer()} in order to start reading and writing the
+     * file.
+     */
+    public IHDF5WriterConfigurator configureInMemory(File file, int initialSize,
+            boolean backingStore);
+
     /**
      * Returns <code>true</code>, if the <var>file</var> is an HDF5 file and <code>false</code>
      * otherwise.
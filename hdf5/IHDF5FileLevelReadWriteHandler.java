@@ -17,6 +17,7 @@
 package ch.systemsx.cisd.hdf5;
 
 import java.io.Flushable;
+import java.util.concurrent.Future;
 
 import ch.systemsx.cisd.hdf5.IHDF5WriterConfigurator.FileFormat;
 
@@ -63,6 +64,34 @@ public interface IHDF5FileLevelReadWriteHandler extends IHDF5FileLevelReadOnlyHa
      */
     public void flushSyncBlocking();
 
+    /**
+     * Flushes the cache to disk (without discarding it) and requests to synchronize the file with
+     * the underlying storage using a method like <code>fsync(2)</code>, regardless of what
+     * {@link IHDF5WriterConfigurator.SyncMode} has been set for this file, but without waiting for
+     * it.
+     * <p>
+     * Requests of all writers are served by a bounded pool of threads. Requests for the same file
+     * that come in while a sync of the file is waiting to start are served by that one sync, so
+     * calling this method often from many threads or writers does not lead to an equal number of
+     * <code>fsync(2)</code> calls.
+     * 
+     * @return A future that is done when the data written before this call are durable. Calling
+     *         {@link Future#get()} re-throws an exception of the sync as the cause of an
+     *         {@link java.util.concurrent.ExecutionException}. The future cannot be cancelled.
+     */
+    public Future<Void> flushAsync();
+
+    /**
+     * Returns the statistics of the <code>fsync(2)</code> calls of this file.
+     */
+    public HDF5SyncStatistics getSyncStatistics();
+
+    /**
+     * Returns the statistics of the <code>fsync(2)</code> calls of all HDF5 files written by this
+     * JVM.
+     */
+    public HDF5SyncStatistics getGlobalSyncStatistics();
+
     /**
      * Adds a {@link Flushable} to the set of flushables. This set is flushed when {@link #flush()}
      * or {@link #flushSyncBlocking()} are called and before the writer is closed.
@@ -16,6 +16,8 @@
 
 package ch.systemsx.cisd.hdf5;
 
+import java.nio.LongBuffer;
+
 import ch.systemsx.cisd.base.mdarray.MDLongArray;
 
 /**
@@ -295,6 +297,24 @@ public interface IHDF5LongWriter extends IHDF5UnsignedLongWriter
     @Override
     public void writeArrayBlockWithOffset(HDF5DataSet dataSet, long[] data,
             int dataSize, long offset);
+
+    /**
+     * Writes the remaining elements of <var>buffer</var> as a block of a <code>long</code> array
+     * (of rank 1) to the data set <var>objectPath</var>, starting at <var>offset</var>. The data
+     * set needs to have been created beforehand and is extended if needed. On return, the position
+     * of <var>buffer</var> is advanced to its limit.
+     * <p>
+     * <i>Note: the native library shipped with this release cannot write from buffers. The data are
+     * copied from <var>buffer</var> into a temporary Java array and written from there, which is
+     * one copy more than writing from an array. Only a direct buffer in native byte order is
+     * written without the temporary array, and only if the native library supports it, see
+     * {@link ch.systemsx.cisd.hdf5.hdf5lib.H5Features#isBufferWriteAvailable()}.</i>
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param offset The offset in the data set to start writing to.
+     * @param buffer The buffer to write the data from.
+     */
+    public void writeFromBuffer(String objectPath, long offset, LongBuffer buffer);
             
     /**
      * Writes out a <code>long</code> matrix (array of rank 2).
@@ -78,6 +78,19 @@ public interface IHDF5ObjectReadOnlyInfoProviderHandler
     
     public HDF5DataSet openDataSet(final String objectPath);
 
+    /**
+     * Opens the data set <var>objectPath</var> with its own raw data chunk cache as given by
+     * <var>chunkCache</var>, overriding the file-level chunk cache parameters. Use this for data
+     * sets that are accessed in an order that touches many chunks, e.g. when reading a chunked
+     * matrix column by column.
+     * <p>
+     * Needs a native library that provides <code>H5Pset_chunk_cache</code>, otherwise an
+     * {@link ncsa.hdf.hdf5lib.exceptions.HDF5JavaException} is thrown. The file-level chunk cache
+     * set with {@link IHDF5ReaderConfigurator#chunkCache(HDF5ChunkCacheParameters)} works with
+     * every native library.
+     */
+    public HDF5DataSet openDataSet(final String objectPath, HDF5ChunkCacheParameters chunkCache);
+
     /**
      * Creates and returns an internal (house-keeping) version of <var>objectPath</var>.
      */
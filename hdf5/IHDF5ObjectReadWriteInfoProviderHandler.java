@@ -174,6 +174,35 @@ public interface IHDF5ObjectReadWriteInfoProviderHandler extends IHDF5ObjectRead
      */
     public void setDataSetDimensions(final String objectPath, final long[] newDimensions);
 
+    /**
+     * Writes <var>chunkBytes</var> as the chunk at <var>chunkOffset</var> of <var>dataSet</var>
+     * without passing it through the filter pipeline. The chunk needs to be encoded already with
+     * the filters of the data set, e.g. as obtained from another file with the same storage
+     * features. This avoids a decompress / compress cycle when moving compressed chunks around.
+     * <p>
+     * <i>Note: the data set needs to be extended to cover the chunk before it is written.</i>
+     * 
+     * @param dataSet The data set to write the chunk to.
+     * @param chunkOffset The offset of the first element of the chunk in the data set. Needs to be
+     *            a multiple of the chunk size in each dimension.
+     * @param filterMask The mask of the filters that have been skipped when encoding the chunk. Bit
+     *            <code>i</code> set means that filter <code>i</code> of the pipeline has not been
+     *            applied. 0 means that all filters have been applied.
+     * @param chunkBytes The encoded chunk.
+     * @throws HDF5JavaException If <var>dataSet</var> is not chunked, <var>chunkOffset</var> has
+     *             the wrong rank or the native library can't write raw chunks, see
+     *             {@link #isWriteChunkRawSupported()}.
+     */
+    public void writeChunkRaw(final HDF5DataSet dataSet, final long[] chunkOffset,
+            final int filterMask, final byte[] chunkBytes) throws HDF5JavaException;
+
+    /**
+     * Returns <code>true</code>, if the native library can write raw chunks with
+     * {@link #writeChunkRaw(HDF5DataSet, long[], int, byte[])}. If not, write the decoded data with
+     * the regular write methods, which pass it through the filter pipeline.
+     */
+    public boolean isWriteChunkRawSupported();
+
     // /////////////////////
     // Types
     // /////////////////////
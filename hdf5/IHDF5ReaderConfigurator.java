@@ -60,6 +60,42 @@ public interface IHDF5ReaderConfigurator
      */
     public IHDF5ReaderConfigurator noAutoDereference();
 
+    /**
+     * Sets the parameters of the raw data chunk cache that all data sets of this file use by
+     * default. Individual data sets can override them in
+     * {@link IHDF5ObjectReadOnlyInfoProviderHandler#openDataSet(String, HDF5ChunkCacheParameters)}.
+     * <br>
+     * <i>Note: the library default is a chunk cache of 1 MB with 521 slots.</i>
+     */
+    public IHDF5ReaderConfigurator chunkCache(HDF5ChunkCacheParameters chunkCache);
+
+    /**
+     * Sets the size of the metadata cache to <var>size</var> bytes. The cache starts at this size
+     * and may shrink to 1 MB when it is not needed. A larger cache makes opening and enumerating
+     * files with many objects faster.
+     * <p>
+     * The library accepts sizes from 1 kB (1024 bytes) to 128 MB (134217728 bytes), other sizes
+     * are rejected with an {@link IllegalArgumentException}.
+     * <p>
+     * Needs a native library that provides <code>H5Pset_mdc_config</code>, otherwise opening the
+     * file fails.
+     * <br>
+     * <i>Note: the library default is a metadata cache of 2 MB that adapts between 1 MB and
+     * 32 MB.</i>
+     */
+    public IHDF5ReaderConfigurator metaDataCacheSize(long size);
+
+    /**
+     * Converts compound records in Java when the compound type of a data set differs from the
+     * memory type, e.g. because members have been reordered, widened or added since the file was
+     * written. The records are read in the layout of the file and the members are copied to the
+     * memory layout with a plan that is computed once per data set. Conversions that cannot be done
+     * exactly in Java are left to the library.
+     * <br>
+     * <i>Note: by default, all compound conversions are done by the library.</i>
+     */
+    public IHDF5ReaderConfigurator convertCompoundsInJava();
+
     /**
      * Returns an {@link IHDF5Reader} based on this configuration.
      */
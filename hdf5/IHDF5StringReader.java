@@ -299,6 +299,100 @@ public interface IHDF5StringReader
     public Iterable<HDF5DataBlock<String[]>> getArrayNaturalBlocksRaw(final String objectPath)
             throws HDF5JavaException;
 
+    /**
+     * Reads a fixed-length string array (of rank 1) from the data set <var>objectPath</var> into a
+     * packed array, without decoding the elements. Considers '\0' as end of string.
+     *
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @return The data read from the data set.
+     * @throws HDF5JavaException If the <var>objectPath</var> is not a fixed-length string type.
+     */
+    public HDF5PackedStringArray readArrayPacked(final String objectPath)
+            throws HDF5JavaException;
+
+    /**
+     * Reads a block of a fixed-length string array (of rank 1) from the data set
+     * <var>objectPath</var> into a packed array, without decoding the elements. Considers '\0' as
+     * end of string.
+     *
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param blockSize The size of the block to read from the data set.
+     * @param offset The offset of the block in the data set.
+     * @return The data read from the data set.
+     * @throws HDF5JavaException If the <var>objectPath</var> is not a fixed-length string type.
+     */
+    public HDF5PackedStringArray readArrayBlockWithOffsetPacked(final String objectPath,
+            final int blockSize, final long offset) throws HDF5JavaException;
+
+    /**
+     * Provides all natural blocks of this one-dimensional fixed-length string data set to iterate
+     * over as packed arrays. Considers '\0' as end of string.
+     *
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @see HDF5DataBlock
+     * @throws HDF5JavaException If the data set is not of rank 1 or not a fixed-length string
+     *             type.
+     */
+    public Iterable<HDF5DataBlock<HDF5PackedStringArray>> getArrayNaturalBlocksPacked(
+            final String objectPath) throws HDF5JavaException;
+
+    // /////////////////////
+    // Dictionary-encoded
+    // /////////////////////
+
+    /**
+     * Returns <code>true</code>, if <var>objectPath</var> is a string array written with
+     * {@link IHDF5StringWriter#writeArrayDictionaryEncoded(String, String[])}. Such a data set can
+     * be read with {@link #readArray(String)} like any other string array.
+     *
+     * @param objectPath The name (including path information) of the data set object in the file.
+     */
+    public boolean isDictionaryEncoded(final String objectPath);
+
+    /**
+     * Reads the dictionary of the dictionary-encoded string array <var>objectPath</var>. The code
+     * of a value is its index in the dictionary.
+     *
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @return The distinct values of the data set.
+     * @throws HDF5JavaException If the <var>objectPath</var> is not dictionary-encoded.
+     */
+    public String[] readDictionary(final String objectPath) throws HDF5JavaException;
+
+    /**
+     * Returns the code of <var>value</var> in the dictionary-encoded string array
+     * <var>objectPath</var>, or <code>-1</code>, if <var>value</var> does not occur in the data
+     * set. Use it together with {@link #readDictionaryCodes(String)} to filter for equality without
+     * decoding the strings.
+     *
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param value The value to get the code for.
+     * @throws HDF5JavaException If the <var>objectPath</var> is not dictionary-encoded.
+     */
+    public int getDictionaryCode(final String objectPath, final String value)
+            throws HDF5JavaException;
+
+    /**
+     * Reads the codes of the dictionary-encoded string array <var>objectPath</var>.
+     *
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @return The codes read from the data set.
+     * @throws HDF5JavaException If the <var>objectPath</var> is not dictionary-encoded.
+     */
+    public int[] readDictionaryCodes(final String objectPath) throws HDF5JavaException;
+
+    /**
+     * Reads a block of the codes of the dictionary-encoded string array <var>objectPath</var>.
+     *
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param blockSize The size of the block to read from the data set.
+     * @param offset The offset of the block in the data set.
+     * @return The codes read from the data set.
+     * @throws HDF5JavaException If the <var>objectPath</var> is not dictionary-encoded.
+     */
+    public int[] readDictionaryCodesBlockWithOffset(final String objectPath,
+            final int blockSize, final long offset) throws HDF5JavaException;
+
     /**
      * Provides all natural blocks of this multi-dimensional string data set to iterate over.
      * Considers '\0' as end of string.
@@ -207,6 +207,35 @@ public interface IHDF5StringWriter extends IHDF5StringReader
     public void writeArray(final String objectPath, final String[] data, final int maxLength,
             final HDF5GenericStorageFeatures features);
 
+    /**
+     * Writes out a <code>String</code> array (of rank 1) in dictionary-encoded form: the distinct
+     * values of <var>data</var> go into a dictionary data set and <var>objectPath</var> holds the
+     * index of each element in the dictionary as an integer code. This is much smaller for arrays
+     * with few distinct values. The data set is read back with
+     * {@link IHDF5StringReader#readArray(String)}; the codes can be read with
+     * {@link IHDF5StringReader#readDictionaryCodes(String)}.
+     * <p>
+     * The data set refers to its dictionary by an object reference. Moving or deleting the data
+     * set with {@link IHDF5ObjectReadWriteInfoProviderHandler#move(String, String)} or
+     * {@link IHDF5ObjectReadWriteInfoProviderHandler#delete(String)} moves or deletes the
+     * dictionary along with it.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param data The data to write. Must not be <code>null</code>.
+     */
+    public void writeArrayDictionaryEncoded(final String objectPath, final String[] data);
+
+    /**
+     * Writes out a <code>String</code> array (of rank 1) in dictionary-encoded form, see
+     * {@link #writeArrayDictionaryEncoded(String, String[])}.
+     * 
+     * @param objectPath The name (including path information) of the data set object in the file.
+     * @param data The data to write. Must not be <code>null</code>.
+     * @param features The storage features of the code and the dictionary data set.
+     */
+    public void writeArrayDictionaryEncoded(final String objectPath, final String[] data,
+            final HDF5GenericStorageFeatures features);
+
     /**
      * Writes out a <code>String</code> array (of rank N). Each element of the array will have a
      * fixed maximal length which is defined by the longest string in <var>data</var>.
@@ -172,6 +172,114 @@ public interface IHDF5WriterConfigurator extends IHDF5ReaderConfigurator
      */
     public IHDF5WriterConfigurator houseKeepingNameSuffix(String houseKeepingNameSuffix);
 
+    /**
+     * Sets the parameters of the raw data chunk cache that all data sets of this file use by
+     * default.
+     * <br>
+     * <i>Note: the library default is a chunk cache of 1 MB with 521 slots.</i>
+     */
+    @Override
+    public IHDF5WriterConfigurator chunkCache(HDF5ChunkCacheParameters chunkCache);
+
+    /**
+     * Sets the size of the metadata cache. See
+     * {@link IHDF5ReaderConfigurator#metaDataCacheSize(long)}.
+     */
+    @Override
+    public IHDF5WriterConfigurator metaDataCacheSize(long size);
+
+    /**
+     * Converts compound records in Java when the compound type of a data set differs from the
+     * memory type. See {@link IHDF5ReaderConfigurator#convertCompoundsInJava()}.
+     */
+    @Override
+    public IHDF5WriterConfigurator convertCompoundsInJava();
+
+    /**
+     * Compresses the chunks of data sets written by <code>writeMDArray()</code> and
+     * <code>writeArrayBlockWithOffset()</code> on <var>numberOfThreads</var> threads instead of in
+     * the filter pipeline of the library. The chunks are written in order and are byte-identical to
+     * what the filter pipeline would write, provided the JRE and the HDF5 library use the same zlib.
+     * <p>
+     * This applies to chunked data sets that are deflated (with or without shuffling), but not
+     * scaled, whose storage type is the native type and to blocks that are aligned to the chunk
+     * grid. All other writes go through the filter pipeline as usual.
+     * <br>
+     * <i>Note: by default, compression is done in the filter pipeline.</i>
+     */
+    public IHDF5WriterConfigurator parallelCompression(int numberOfThreads);
+
+    /**
+     * Buffers blocks of less than <var>bufferSize</var> bytes that are written to one-dimensional
+     * data sets with <code>writeArrayBlockWithOffset()</code> and writes adjacent blocks as one.
+     * For a chunked data set, the buffer is extended to end on a chunk boundary and written split
+     * at chunk boundaries. A chunked data set that such blocks are appended to is extended
+     * geometrically and trimmed to the data written when it is accessed otherwise.
+     * <p>
+     * The buffers are written when they are full, when a block is not adjacent to the buffered
+     * ones, before the data set (or a group containing it) is accessed by any other operation of
+     * the writer and on flush and close. Until then, the buffered data are not visible to other
+     * readers of the file.
+     * <br>
+     * <i>Note: by default, every block is written immediately.</i>
+     *
+     * @see #writeBehindBuffering()
+     */
+    public IHDF5WriterConfigurator writeBehindBuffering(int bufferSize);
+
+    /**
+     * Buffers blocks that are written to one-dimensional data sets with
+     * <code>writeArrayBlockWithOffset()</code> like {@link #writeBehindBuffering(int)}, with a
+     * buffer size of one chunk of the data set. Blocks of at least one chunk are written
+     * immediately. For data sets that are not chunked, a buffer size of 64 KiB is used.
+     */
+    public IHDF5WriterConfigurator writeBehindBuffering();
+
+    /**
+     * Sets the size of the blocks that the library reserves for the raw data of small contiguous
+     * data sets. Data sets that fit into the remainder of such a block are stored next to each
+     * other, which makes files with many small data sets smaller and faster to write and read.
+     * A size of 0 disables this aggregation.
+     * <br>
+     * <i>Note: the library default is 2048 bytes.</i>
+     */
+    public IHDF5WriterConfigurator smallDataBlockSize(long size);
+
+    /**
+     * Aligns every object in the file that is at least <var>threshold</var> bytes large to a
+     * multiple of <var>alignment</var> bytes, e.g. to the block size of a parallel file system or
+     * of a RAID. As every aligned object may leave a gap before it, a <var>threshold</var> well
+     * above the size of metadata objects should be chosen for files with many small data sets.
+     * <br>
+     * <i>Note: by default, objects are not aligned.</i>
+     */
+    public IHDF5WriterConfigurator alignment(long threshold, long alignment);
+
+    /**
+     * Sets the minimum size of the blocks that the library allocates for metadata. The metadata
+     * of objects created one after the other is aggregated in such blocks, which makes opening
+     * and enumerating files with many small objects faster.
+     * <p>
+     * Needs a native library that provides <code>H5Pset_meta_block_size</code>, otherwise
+     * creating or opening the file fails.
+     * <br>
+     * <i>Note: the library default is 2048 bytes.</i>
+     */
+    public IHDF5WriterConfigurator metaBlockSize(long size);
+
+    /**
+     * Keeps the file in memory, using the core driver of the library. The memory is allocated and
+     * grown in steps of <var>increment</var> bytes. If the file exists and is not overwritten, it
+     * is read into memory when it is opened.
+     * <p>
+     * If <var>backingStore</var> is <code>true</code>, the file is written to disk when the writer
+     * is closed, otherwise it is discarded and nothing is ever written to disk. In both cases, no
+     * <code>fsync(2)</code> is performed, whatever {@link SyncMode} has been set.
+     * <br>
+     * <i>Note: by default, files are read from and written to disk directly.</i>
+     */
+    public IHDF5WriterConfigurator inMemory(int increment, boolean backingStore);
+
     /**
      * Returns an {@link IHDF5Writer} based on this configuration.
      */
@@ -34,6 +34,24 @@ class H5
     /** Expected minimal release number of the library. */
     private final static int expectedRelnum = 13;
 
+    /**
+     * Name of the system property that switches on the concurrent mode. The mode is only switched
+     * on if the native library reports that it has been built thread-safe (HDF5 configure option
+     * <code>--enable-threadsafe</code>).
+     */
+    public final static String THREADSAFE_PROPERTY_NAME = "jhdf5.threadsafe";
+
+    /**
+     * If <code>true</code>, the native library has been built thread-safe.
+     */
+    private final static boolean libraryThreadSafe;
+
+    /**
+     * If <code>true</code>, the native library is thread-safe and the wrappers do not serialize
+     * their calls on the global monitor.
+     */
+    private final static boolean threadSafe;
+
     static
     {
         synchronized (ncsa.hdf.hdf5lib.H5.class)
@@ -66,6 +84,27 @@ class H5
                         + ", but we require " + expectedMajnum + "." + expectedMinnum + ".x with x >= "
                         + expectedRelnum + ".");
             }
+
+            libraryThreadSafe = probeLibraryThreadSafe();
+            threadSafe = libraryThreadSafe && Boolean.getBoolean(THREADSAFE_PROPERTY_NAME);
+        }
+    }
+
+    /**
+     * Asks the native library whether it has been built thread-safe. Libraries that lack
+     * <code>H5is_library_threadsafe</code> are taken to be not thread-safe.
+     */
+    private static boolean probeLibraryThreadSafe()
+    {
+        try
+        {
+            return H5is_library_threadsafe();
+        } catch (UnsatisfiedLinkError ex)
+        {
+            return false;
+        } catch (HDF5LibraryException ex)
+        {
+            return false;
         }
     }
 
@@ -74,6 +113,27 @@ class H5
     {
     }
 
+    /**
+     * Returns <code>true</code>, if the wrappers run in concurrent mode, i.e. if calls into the
+     * native library from different threads are not serialized by the wrappers.
+     * <p>
+     * By default, the wrappers synchronize on the global monitor shared with the HDF Group's
+     * HDF-Java library, which serializes all calls into the native library. In concurrent mode,
+     * the native library protects itself and the wrappers call it without synchronizing.
+     */
+    public static boolean isThreadSafe()
+    {
+        return threadSafe;
+    }
+
+    /**
+     * Returns <code>true</code>, if the native library has been built thread-safe.
+     */
+    static boolean isLibraryThreadSafe()
+    {
+        return libraryThreadSafe;
+    }
+
     // ////////////////////////////////////////////////////////////////
 
     /**
@@ -171,6 +231,14 @@ class H5
      */
     public static native int H5get_libversion(int[] libversion) throws HDF5LibraryException;
 
+    /**
+     * H5is_library_threadsafe determines whether the library has been built thread-safe.
+     * 
+     * @return <code>true</code>, if the library is thread-safe.
+     * @exception HDF5LibraryException - Error from the HDF-5 Library.
+     */
+    private static native boolean H5is_library_threadsafe() throws HDF5LibraryException;
+
     /**
      * H5check_version verifies that the arguments match the version numbers compiled into the
      * library.
@@ -660,6 +728,66 @@ class H5
             int file_space_id, int xfer_plist_id, byte[] buf) throws HDF5LibraryException,
             NullPointerException;
 
+    /**
+     * H5Dread reads a (partial) dataset, specified by its identifier dataset_id, from the file
+     * into the direct buffer buf, without an intermediate Java array. The data are stored starting
+     * at the address of buf, the position of buf is ignored.
+     * 
+     * @param dataset_id Identifier of the dataset read from.
+     * @param mem_type_id Identifier of the memory datatype.
+     * @param mem_space_id Identifier of the memory dataspace.
+     * @param file_space_id Identifier of the dataset's dataspace in the file.
+     * @param xfer_plist_id Identifier of a transfer property list for this I/O operation.
+     * @param buf Direct buffer to store data read from the file.
+     * @return a non-negative value if successful
+     * @exception HDF5LibraryException - Error from the HDF-5 Library.
+     * @exception NullPointerException - data buffer is null.
+     * @exception IllegalArgumentException - buf is not a direct buffer.
+     */
+    public static native int H5Dread(int dataset_id, int mem_type_id, int mem_space_id,
+            int file_space_id, int xfer_plist_id, java.nio.Buffer buf) throws HDF5LibraryException,
+            NullPointerException;
+
+    /**
+     * H5Dwrite writes a (partial) dataset, specified by its identifier dataset_id, from the direct
+     * buffer buf into the file, without an intermediate Java array. The data are taken starting at
+     * the address of buf, the position of buf is ignored.
+     * 
+     * @param dataset_id Identifier of the dataset read from.
+     * @param mem_type_id Identifier of the memory datatype.
+     * @param mem_space_id Identifier of the memory dataspace.
+     * @param file_space_id Identifier of the dataset's dataspace in the file.
+     * @param xfer_plist_id Identifier of a transfer property list for this I/O operation.
+     * @param buf Direct buffer with data to be written to the file.
+     * @return a non-negative value if successful
+     * @exception HDF5LibraryException - Error from the HDF-5 Library.
+     * @exception NullPointerException - data buffer is null.
+     * @exception IllegalArgumentException - buf is not a direct buffer.
+     */
+    public static native int H5Dwrite(int dataset_id, int mem_type_id, int mem_space_id,
+            int file_space_id, int xfer_plist_id, java.nio.Buffer buf) throws HDF5LibraryException,
+            NullPointerException;
+
+    /**
+     * H5DOwrite_chunk writes a raw data chunk as is to a chunked dataset, bypassing the filter
+     * pipeline. The chunk needs to be encoded already with the filters of the dataset. Requires
+     * HDF5 1.8.11 or newer (high-level library).
+     * 
+     * @param dataset_id Identifier of the dataset to write to.
+     * @param xfer_plist_id Identifier of a transfer property list for this I/O operation.
+     * @param filter_mask Mask of the filters of the pipeline that have been skipped when encoding
+     *            the chunk, 0 if all filters have been applied.
+     * @param offset The logical position of the chunk's first element in the dataspace.
+     * @param data_size The size of the encoded chunk in bytes.
+     * @param buf Buffer with the encoded chunk.
+     * @return a non-negative value if successful
+     * @exception HDF5LibraryException - Error from the HDF-5 Library.
+     * @exception NullPointerException - offset or buf is null.
+     */
+    public static native int H5DOwrite_chunk(int dataset_id, int xfer_plist_id, int filter_mask,
+            long[] offset, int data_size, byte[] buf) throws HDF5LibraryException,
+            NullPointerException;
+
     /**
      * H5Dextend verifies that the dataset is at least of size size.
      * 
@@ -1165,6 +1293,20 @@ class H5
     public static native int H5Pget_small_data_block_size(int plist, long[] size)
             throws HDF5LibraryException, NullPointerException;
 
+    /**
+     * H5Pset_meta_block_size sets the minimum size of the blocks that metadata is allocated in
+     * from the file, so that the metadata of many small objects is stored close together. Needs a
+     * native library that provides this function, see
+     * {@link H5Features#isMetaBlockSizeAvailable()}.
+     * 
+     * @param fapl_id IN: Identifier of the file access property list.
+     * @param size IN: Minimum size of the metadata blocks in bytes.
+     * @return a non-negative value if successful
+     * @exception HDF5LibraryException - Error from the HDF-5 Library.
+     */
+    public static native int H5Pset_meta_block_size(int fapl_id, long size)
+            throws HDF5LibraryException;
+
     /**
      * H5Pset_sizes sets the byte size of the offsets and lengths used to address objects in an HDF5
      * file.
@@ -1704,6 +1846,23 @@ class H5
     public static native int H5Pset_cache(int plist, int mdc_nelmts, int rdcc_nelmts,
             int rdcc_nbytes, double rdcc_w0) throws HDF5LibraryException;
 
+    /**
+     * H5Pset_mdc_config sets the size of the metadata cache in a file access property list. The
+     * other fields of the cache configuration are kept as returned by
+     * <code>H5Pget_mdc_config</code>, with automatic resizing between <var>min_size</var> and
+     * <var>max_size</var>. Needs a native library that provides this function, see
+     * {@link H5Features#isMetaDataCacheConfigAvailable()}.
+     * 
+     * @param plist_id IN: Identifier of the file access property list.
+     * @param initial_size IN: Initial size of the metadata cache in bytes.
+     * @param min_size IN: Minimum size of the metadata cache in bytes.
+     * @param max_size IN: Maximum size of the metadata cache in bytes.
+     * @return a non-negative value if successful
+     * @exception HDF5LibraryException - Error from the HDF-5 Library.
+     */
+    public static native int H5Pset_mdc_config(int plist_id, long initial_size, long min_size,
+            long max_size) throws HDF5LibraryException;
+
     /**
      * Retrieves the maximum possible number of elements in the meta data cache and the maximum
      * possible number of bytes and the RDCC_W0 value in the raw data chunk cache.
@@ -3668,6 +3827,20 @@ class H5
      */
     public static native int[] H5Pget_libver_bounds(int plist_id) throws HDF5LibraryException;
 
+    /**
+     * Sets the raw data chunk cache parameters of a dataset access property list. Overrides the
+     * file-level defaults set with {@link #H5Pset_cache(int, int, int, int, double)} for datasets
+     * opened with this property list.
+     * 
+     * @param dapl_id Dataset access property list identifier.
+     * @param rdcc_nslots The number of chunk slots in the raw data chunk cache hash table.
+     * @param rdcc_nbytes The total size of the raw data chunk cache, in bytes.
+     * @param rdcc_w0 The chunk preemption policy.
+     * @return a non-negative value if successful
+     */
+    public static native int H5Pset_chunk_cache(int dapl_id, long rdcc_nslots, long rdcc_nbytes,
+            double rdcc_w0) throws HDF5LibraryException;
+
     /**
      * Sets the local heap size hint for an old-style group. This is the chunk size allocated on the
      * heap for a group.
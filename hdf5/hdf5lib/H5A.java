@@ -39,6 +39,10 @@ public class H5A
     public static boolean H5Aexists(int obj_id, String name) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Aexists(obj_id, name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Aexists(obj_id, name);
@@ -62,6 +66,10 @@ public class H5A
             int create_plist_id, int access_plist_id) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Acreate(loc_id, name, type_id, space_id, create_plist_id, access_plist_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Acreate(loc_id, name, type_id, space_id, create_plist_id, access_plist_id);
@@ -81,6 +89,10 @@ public class H5A
     public static int H5Aopen_name(int loc_id, String name) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Aopen_name(loc_id, name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Aopen_name(loc_id, name);
@@ -99,6 +111,10 @@ public class H5A
      */
     public static int H5Aopen_idx(int loc_id, int idx) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Aopen_idx(loc_id, idx);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Aopen_idx(loc_id, idx);
@@ -119,6 +135,10 @@ public class H5A
     public static int H5Awrite(int attr_id, int mem_type_id, byte[] buf)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Awrite(attr_id, mem_type_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Awrite(attr_id, mem_type_id, buf);
@@ -139,6 +159,10 @@ public class H5A
     public static int H5Awrite(int attr_id, int mem_type_id, short[] buf)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Awrite(attr_id, mem_type_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Awrite(attr_id, mem_type_id, buf);
@@ -159,6 +183,10 @@ public class H5A
     public static int H5Awrite(int attr_id, int mem_type_id, int[] buf)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Awrite(attr_id, mem_type_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Awrite(attr_id, mem_type_id, buf);
@@ -179,6 +207,10 @@ public class H5A
     public static int H5Awrite(int attr_id, int mem_type_id, long[] buf)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Awrite(attr_id, mem_type_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Awrite(attr_id, mem_type_id, buf);
@@ -199,6 +231,10 @@ public class H5A
     public static int H5Awrite(int attr_id, int mem_type_id, float[] buf)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Awrite(attr_id, mem_type_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Awrite(attr_id, mem_type_id, buf);
@@ -219,6 +255,10 @@ public class H5A
     public static int H5Awrite(int attr_id, int mem_type_id, double[] buf)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Awrite(attr_id, mem_type_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Awrite(attr_id, mem_type_id, buf);
@@ -239,6 +279,10 @@ public class H5A
     public static int H5AwriteString(int attr_id, int mem_type_id, String[] buf)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5AwriteString(attr_id, mem_type_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5AwriteString(attr_id, mem_type_id, buf);
@@ -253,6 +297,10 @@ public class H5A
      */
     public static int H5Acopy(int src_aid, int dst_aid) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Acopy(src_aid, dst_aid);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Acopy(src_aid, dst_aid);
@@ -273,6 +321,10 @@ public class H5A
     public static int H5Aread(int attr_id, int mem_type_id, byte[] buf)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Aread(attr_id, mem_type_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Aread(attr_id, mem_type_id, buf);
@@ -293,6 +345,10 @@ public class H5A
     public static int H5Aread(int attr_id, int mem_type_id, short[] buf)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Aread(attr_id, mem_type_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Aread(attr_id, mem_type_id, buf);
@@ -313,6 +369,10 @@ public class H5A
     public static int H5Aread(int attr_id, int mem_type_id, int[] buf) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Aread(attr_id, mem_type_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Aread(attr_id, mem_type_id, buf);
@@ -333,6 +393,10 @@ public class H5A
     public static int H5Aread(int attr_id, int mem_type_id, long[] buf)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Aread(attr_id, mem_type_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Aread(attr_id, mem_type_id, buf);
@@ -353,6 +417,10 @@ public class H5A
     public static int H5Aread(int attr_id, int mem_type_id, float[] buf)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Aread(attr_id, mem_type_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Aread(attr_id, mem_type_id, buf);
@@ -373,6 +441,10 @@ public class H5A
     public static int H5Aread(int attr_id, int mem_type_id, double[] buf)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Aread(attr_id, mem_type_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Aread(attr_id, mem_type_id, buf);
@@ -382,6 +454,10 @@ public class H5A
     public static int H5AreadVL(int attr_id, int mem_type_id, String[] buf)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5AreadVL(attr_id, mem_type_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5AreadVL(attr_id, mem_type_id, buf);
@@ -397,6 +473,10 @@ public class H5A
      */
     public static int H5Aget_space(int attr_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Aget_space(attr_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Aget_space(attr_id);
@@ -412,6 +492,10 @@ public class H5A
      */
     public static int H5Aget_type(int attr_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Aget_type(attr_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Aget_type(attr_id);
@@ -435,6 +519,10 @@ public class H5A
             throws ArrayIndexOutOfBoundsException, ArrayStoreException, HDF5LibraryException,
             NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Aget_name(attr_id, buf_size, name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Aget_name(attr_id, buf_size, name);
@@ -451,6 +539,10 @@ public class H5A
      */
     public static int H5Aget_num_attrs(int loc_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Aget_num_attrs(loc_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Aget_num_attrs(loc_id);
@@ -470,6 +562,10 @@ public class H5A
     public static int H5Adelete(int loc_id, String name) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Adelete(loc_id, name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Adelete(loc_id, name);
@@ -485,6 +581,10 @@ public class H5A
      */
     public static int H5Aclose(int attr_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Aclose(attr_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Aclose(attr_id);
@@ -52,6 +52,12 @@ public class H5D
             int link_create_plist_id, int dset_create_plist_id, int dset_access_plist_id)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dcreate(loc_id, name, type_id, space_id, link_create_plist_id,
+                    dset_create_plist_id, dset_access_plist_id);
+
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dcreate(loc_id, name, type_id, space_id, link_create_plist_id,
@@ -73,6 +79,10 @@ public class H5D
     public static int H5Dopen(int loc_id, String name, int access_plist_id)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dopen(loc_id, name, access_plist_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dopen(loc_id, name, access_plist_id);
@@ -82,6 +92,10 @@ public class H5D
     public static int H5Dchdir_ext(String dir_name) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dchdir_ext(dir_name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dchdir_ext(dir_name);
@@ -91,6 +105,10 @@ public class H5D
     public static int H5Dgetdir_ext(String[] dir_name, int size) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dgetdir_ext(dir_name, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dgetdir_ext(dir_name, size);
@@ -106,6 +124,10 @@ public class H5D
      */
     public static int H5Dget_space(int dataset_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dget_space(dataset_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dget_space(dataset_id);
@@ -121,6 +143,10 @@ public class H5D
      */
     public static int H5Dget_type(int dataset_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dget_type(dataset_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dget_type(dataset_id);
@@ -137,6 +163,10 @@ public class H5D
      */
     public static int H5Dget_create_plist(int dataset_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dget_create_plist(dataset_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dget_create_plist(dataset_id);
@@ -160,6 +190,11 @@ public class H5D
     public static int H5Dread(int dataset_id, int mem_type_id, int mem_space_id, int file_space_id,
             int xfer_plist_id, byte[] buf) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dread(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dread(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
@@ -171,6 +206,11 @@ public class H5D
             int file_space_id, int xfer_plist_id, Object[] buf) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5DreadVL(dataset_id, mem_type_id, mem_space_id, file_space_id,
+                    xfer_plist_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5DreadVL(dataset_id, mem_type_id, mem_space_id, file_space_id,
@@ -198,6 +238,11 @@ public class H5D
             int file_space_id, int xfer_plist_id, String[] buf) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5DwriteString(dataset_id, mem_type_id, mem_space_id, file_space_id,
+                    xfer_plist_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5DwriteString(dataset_id, mem_type_id, mem_space_id, file_space_id,
@@ -223,6 +268,11 @@ public class H5D
             int file_space_id, int xfer_plist_id, byte[] buf) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dwrite(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dwrite(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
@@ -230,6 +280,107 @@ public class H5D
         }
     }
 
+    /**
+     * H5Dread reads a (partial) dataset, specified by its identifier dataset_id, from the file
+     * into the direct buffer buf, without an intermediate Java array. The data are stored starting
+     * at the address of buf, the position of buf is ignored.
+     * Not every build of the native library provides this function, see
+     * {@link H5Features#isBufferReadAvailable()}.
+     * 
+     * @param dataset_id Identifier of the dataset read from.
+     * @param mem_type_id Identifier of the memory datatype.
+     * @param mem_space_id Identifier of the memory dataspace.
+     * @param file_space_id Identifier of the dataset's dataspace in the file.
+     * @param xfer_plist_id Identifier of a transfer property list for this I/O operation.
+     * @param buf Direct buffer to store data read from the file.
+     * @return a non-negative value if successful
+     * @exception HDF5LibraryException - Error from the HDF-5 Library.
+     * @exception NullPointerException - data buffer is null.
+     * @exception IllegalArgumentException - buf is not a direct buffer.
+     */
+    public static int H5Dread(int dataset_id, int mem_type_id, int mem_space_id,
+            int file_space_id, int xfer_plist_id, java.nio.Buffer buf) throws HDF5LibraryException,
+            NullPointerException
+    {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dread(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
+        synchronized (ncsa.hdf.hdf5lib.H5.class)
+        {
+            return H5.H5Dread(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
+    }
+
+    /**
+     * H5Dwrite writes a (partial) dataset, specified by its identifier dataset_id, from the direct
+     * buffer buf into the file, without an intermediate Java array. The data are taken starting at
+     * the address of buf, the position of buf is ignored.
+     * Not every build of the native library provides this function, see
+     * {@link H5Features#isBufferWriteAvailable()}.
+     * 
+     * @param dataset_id Identifier of the dataset read from.
+     * @param mem_type_id Identifier of the memory datatype.
+     * @param mem_space_id Identifier of the memory dataspace.
+     * @param file_space_id Identifier of the dataset's dataspace in the file.
+     * @param xfer_plist_id Identifier of a transfer property list for this I/O operation.
+     * @param buf Direct buffer with data to be written to the file.
+     * @return a non-negative value if successful
+     * @exception HDF5LibraryException - Error from the HDF-5 Library.
+     * @exception NullPointerException - data buffer is null.
+     * @exception IllegalArgumentException - buf is not a direct buffer.
+     */
+    public static int H5Dwrite(int dataset_id, int mem_type_id, int mem_space_id,
+            int file_space_id, int xfer_plist_id, java.nio.Buffer buf) throws HDF5LibraryException,
+            NullPointerException
+    {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dwrite(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
+        synchronized (ncsa.hdf.hdf5lib.H5.class)
+        {
+            return H5.H5Dwrite(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
+    }
+
+    /**
+     * H5DOwrite_chunk writes a raw data chunk as is to a chunked dataset, bypassing the filter
+     * pipeline. The chunk needs to be encoded already with the filters of the dataset. Requires
+     * HDF5 1.8.11 or newer (high-level library) and a native library that provides this function,
+     * see {@link H5Features#isWriteChunkAvailable()}.
+     * 
+     * @param dataset_id Identifier of the dataset to write to.
+     * @param xfer_plist_id Identifier of a transfer property list for this I/O operation.
+     * @param filter_mask Mask of the filters of the pipeline that have been skipped when encoding
+     *            the chunk, 0 if all filters have been applied.
+     * @param offset The logical position of the chunk's first element in the dataspace.
+     * @param data_size The size of the encoded chunk in bytes.
+     * @param buf Buffer with the encoded chunk.
+     * @return a non-negative value if successful
+     * @exception HDF5LibraryException - Error from the HDF-5 Library.
+     * @exception NullPointerException - offset or buf is null.
+     */
+    public static int H5DOwrite_chunk(int dataset_id, int xfer_plist_id, int filter_mask,
+            long[] offset, int data_size, byte[] buf) throws HDF5LibraryException,
+            NullPointerException
+    {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5DOwrite_chunk(dataset_id, xfer_plist_id, filter_mask, offset, data_size,
+                    buf);
+        }
+        synchronized (ncsa.hdf.hdf5lib.H5.class)
+        {
+            return H5.H5DOwrite_chunk(dataset_id, xfer_plist_id, filter_mask, offset, data_size,
+                    buf);
+        }
+    }
+
     /**
      * H5Dextend verifies that the dataset is at least of size size.
      * 
@@ -242,6 +393,10 @@ public class H5D
     public static int H5Dextend(int dataset_id, byte[] size) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dextend(dataset_id, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dextend(dataset_id, size);
@@ -270,6 +425,10 @@ public class H5D
     public static int H5Dset_extent(int dataset_id, byte[] size) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dset_extent(dataset_id, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dset_extent(dataset_id, size);
@@ -293,6 +452,10 @@ public class H5D
      */
     public static int H5Dclose(int dataset_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dclose(dataset_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dclose(dataset_id);
@@ -308,6 +471,10 @@ public class H5D
      */
     public static long H5Dget_storage_size(int dataset_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dget_storage_size(dataset_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dget_storage_size(dataset_id);
@@ -322,6 +489,10 @@ public class H5D
      */
     public static int H5Dcopy(int src_did, int dst_did) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dcopy(src_did, dst_did);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dcopy(src_did, dst_did);
@@ -334,6 +505,10 @@ public class H5D
     public static int H5Dvlen_get_buf_size(int dataset_id, int type_id, int space_id, int[] size)
             throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dvlen_get_buf_size(dataset_id, type_id, space_id, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dvlen_get_buf_size(dataset_id, type_id, space_id, size);
@@ -348,6 +523,10 @@ public class H5D
     public static int H5Dvlen_reclaim(int type_id, int space_id, int xfer_plist_id, byte[] buf)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dvlen_reclaim(type_id, space_id, xfer_plist_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dvlen_reclaim(type_id, space_id, xfer_plist_id, buf);
@@ -357,6 +536,10 @@ public class H5D
     public static int H5Dget_space_status(int dset_id, int[] status) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dget_space_status(dset_id, status);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dget_space_status(dset_id, status);
@@ -376,6 +559,11 @@ public class H5D
     public static int H5Dread(int dataset_id, int mem_type_id, int mem_space_id, int file_space_id,
             int xfer_plist_id, short[] buf) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dread(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dread(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
@@ -386,6 +574,11 @@ public class H5D
     public static int H5Dread(int dataset_id, int mem_type_id, int mem_space_id, int file_space_id,
             int xfer_plist_id, int[] buf) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dread(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dread(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
@@ -396,6 +589,11 @@ public class H5D
     public static int H5Dread(int dataset_id, int mem_type_id, int mem_space_id, int file_space_id,
             int xfer_plist_id, long[] buf) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dread(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dread(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
@@ -406,6 +604,11 @@ public class H5D
     public static int H5Dread(int dataset_id, int mem_type_id, int mem_space_id, int file_space_id,
             int xfer_plist_id, float[] buf) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dread(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dread(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
@@ -416,6 +619,11 @@ public class H5D
     public static int H5Dread(int dataset_id, int mem_type_id, int mem_space_id, int file_space_id,
             int xfer_plist_id, double[] buf) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dread(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dread(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
@@ -427,6 +635,11 @@ public class H5D
             int file_space_id, int xfer_plist_id, String[] buf) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dread_string(dataset_id, mem_type_id, mem_space_id, file_space_id,
+                    xfer_plist_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dread_string(dataset_id, mem_type_id, mem_space_id, file_space_id,
@@ -438,6 +651,11 @@ public class H5D
             int file_space_id, int xfer_plist_id, String[] buf) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dread_reg_ref(dataset_id, mem_type_id, mem_space_id, file_space_id,
+                    xfer_plist_id, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dread_reg_ref(dataset_id, mem_type_id, mem_space_id, file_space_id,
@@ -449,6 +667,11 @@ public class H5D
             int file_space_id, int xfer_plist_id, short[] buf) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dwrite(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dwrite(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
@@ -460,6 +683,11 @@ public class H5D
             int file_space_id, int xfer_plist_id, int[] buf) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dwrite(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dwrite(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
@@ -471,6 +699,11 @@ public class H5D
             int file_space_id, int xfer_plist_id, long[] buf) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dwrite(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dwrite(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
@@ -482,6 +715,11 @@ public class H5D
             int file_space_id, int xfer_plist_id, float[] buf) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dwrite(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dwrite(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
@@ -493,6 +731,11 @@ public class H5D
             int file_space_id, int xfer_plist_id, double[] buf) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Dwrite(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
+                    buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Dwrite(dataset_id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id,
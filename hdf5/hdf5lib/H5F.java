@@ -45,6 +45,10 @@ public class H5F
     public static int H5Fopen(String name, int flags, int access_id) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Fopen(name, flags, access_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Fopen(name, flags, access_id);
@@ -77,6 +81,10 @@ public class H5F
     public static int H5Fcreate(String name, int flags, int create_id, int access_id)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Fcreate(name, flags, create_id, access_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Fcreate(name, flags, create_id, access_id);
@@ -106,6 +114,10 @@ public class H5F
      */
     public static int H5Fflush(int object_id, int scope) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Fflush(object_id, scope);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Fflush(object_id, scope);
@@ -122,6 +134,10 @@ public class H5F
      */
     public static boolean H5Fis_hdf5(String name) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Fis_hdf5(name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Fis_hdf5(name);
@@ -138,6 +154,10 @@ public class H5F
      */
     public static int H5Fget_create_plist(int file_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Fget_create_plist(file_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Fget_create_plist(file_id);
@@ -153,6 +173,10 @@ public class H5F
      */
     public static int H5Fget_access_plist(int file_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Fget_access_plist(file_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Fget_access_plist(file_id);
@@ -168,6 +192,10 @@ public class H5F
      */
     public static int H5Fclose(int file_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Fclose(file_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Fclose(file_id);
@@ -190,6 +218,10 @@ public class H5F
     public static int H5Fmount(int loc_id, String name, int child_id, int plist_id)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Fmount(loc_id, name, child_id, plist_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Fmount(loc_id, name, child_id, plist_id);
@@ -209,6 +241,10 @@ public class H5F
     public static int H5Funmount(int loc_id, String name) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Funmount(loc_id, name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Funmount(loc_id, name);
@@ -224,6 +260,10 @@ public class H5F
      */
     public static int H5Freopen(int file_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Freopen(file_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Freopen(file_id);
@@ -233,6 +273,10 @@ public class H5F
     public static int H5Fget_obj_ids(int file_id, int types, int max, int[] obj_id_list)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Fget_obj_ids(file_id, types, max, obj_id_list);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Fget_obj_ids(file_id, types, max, obj_id_list);
@@ -242,6 +286,10 @@ public class H5F
     public static int H5Fget_obj_count(int file_id, int types) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Fget_obj_count(file_id, types);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Fget_obj_count(file_id, types);
@@ -250,6 +298,10 @@ public class H5F
 
     public static long H5Fget_name(int obj_id, String name, int size) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Fget_name(obj_id, name, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Fget_name(obj_id, name, size);
@@ -258,6 +310,10 @@ public class H5F
 
     public static long H5Fget_filesize(int file_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Fget_filesize(file_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Fget_filesize(file_id);
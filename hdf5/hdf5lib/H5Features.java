@@ -0,0 +1,207 @@
+/*
+ * Copyright 2007 - 2014 ETH Zuerich, CISD and SIS.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package ch.systemsx.cisd.hdf5.hdf5lib;
+
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5P_DEFAULT;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5S_ALL;
+import static ch.systemsx.cisd.hdf5.hdf5lib.HDF5Constants.H5T_NATIVE_INT8;
+
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+
+/**
+ * Tells which of the optional functions of the native library are available.
+ * <p>
+ * Some wrappers bind functions whose JNI stubs are not part of every build of the native library.
+ * Calling such a function on a library that lacks it throws an {@link UnsatisfiedLinkError}. Each
+ * function is probed once, on first use, by calling it with an invalid identifier: if the stub is
+ * there, the library rejects the call with an exception, otherwise the call fails to link.
+ * <p>
+ * <b>This is an internal API that should not be expected to be stable between releases!</b>
+ *
+ * @author Bernd Rinn
+ */
+public final class H5Features
+{
+    static
+    {
+        H5.ensureNativeLibIsLoaded();
+    }
+
+    /**
+     * A native function that is probed once for whether it can be called.
+     */
+    private static abstract class Probe
+    {
+        private volatile Boolean availableOrNull;
+
+        /**
+         * Calls the native function with arguments that the library rejects.
+         */
+        abstract void call();
+
+        boolean isAvailable()
+        {
+            Boolean available = availableOrNull;
+            if (available == null)
+            {
+                try
+                {
+                    synchronized (ncsa.hdf.hdf5lib.H5.class)
+                    {
+                        call();
+                    }
+                    available = true;
+                } catch (UnsatisfiedLinkError ex)
+                {
+                    available = false;
+                } catch (RuntimeException ex)
+                {
+                    // Expected: the stub is there and has rejected the invalid identifier.
+                    available = true;
+                }
+                availableOrNull = available;
+            }
+            return available;
+        }
+    }
+
+    private static final Probe chunkCacheProbe = new Probe()
+        {
+            @Override
+            void call()
+            {
+                H5.H5Pset_chunk_cache(-1, 0L, 0L, 0.0);
+            }
+        };
+
+    private static final Probe writeChunkProbe = new Probe()
+        {
+            @Override
+            void call()
+            {
+                H5.H5DOwrite_chunk(-1, H5P_DEFAULT, 0, new long[]
+                    { 0 }, 0, new byte[0]);
+            }
+        };
+
+    private static final Probe bufferReadProbe = new Probe()
+        {
+            @Override
+            void call()
+            {
+                H5.H5Dread(-1, H5T_NATIVE_INT8, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+                        (Buffer) ByteBuffer.allocateDirect(1));
+            }
+        };
+
+    private static final Probe bufferWriteProbe = new Probe()
+        {
+            @Override
+            void call()
+            {
+                H5.H5Dwrite(-1, H5T_NATIVE_INT8, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+                        (Buffer) ByteBuffer.allocateDirect(1));
+            }
+        };
+
+    private static final Probe metaBlockSizeProbe = new Probe()
+        {
+            @Override
+            void call()
+            {
+                H5.H5Pset_meta_block_size(-1, 0L);
+            }
+        };
+
+    private static final Probe metaDataCacheConfigProbe = new Probe()
+        {
+            @Override
+            void call()
+            {
+                H5.H5Pset_mdc_config(-1, 0L, 0L, 0L);
+            }
+        };
+
+    private H5Features()
+    {
+        // Not to be instantiated.
+    }
+
+    /**
+     * Returns <code>true</code>, if <code>H5Pset_chunk_cache</code> is available, that is, if data
+     * sets can be opened with their own raw data chunk cache.
+     */
+    public static boolean isDataSetChunkCacheAvailable()
+    {
+        return chunkCacheProbe.isAvailable();
+    }
+
+    /**
+     * Returns <code>true</code>, if <code>H5DOwrite_chunk</code> is available, that is, if encoded
+     * chunks can be written bypassing the filter pipeline.
+     */
+    public static boolean isWriteChunkAvailable()
+    {
+        return writeChunkProbe.isAvailable();
+    }
+
+    /**
+     * Returns <code>true</code>, if <code>H5Dread</code> can read into a direct {@link Buffer}.
+     */
+    public static boolean isBufferReadAvailable()
+    {
+        return bufferReadProbe.isAvailable();
+    }
+
+    /**
+     * Returns <code>true</code>, if <code>H5Dwrite</code> can write from a direct {@link Buffer}.
+     */
+    public static boolean isBufferWriteAvailable()
+    {
+        return bufferWriteProbe.isAvailable();
+    }
+
+    /**
+     * Returns <code>true</code>, if the native library reports that it has been built thread-safe
+     * by means of <code>H5is_library_threadsafe</code>. Only then, the concurrent mode can be
+     * switched on, see {@link H5General#isThreadSafe()}.
+     */
+    public static boolean isLibraryThreadSafe()
+    {
+        return H5.isLibraryThreadSafe();
+    }
+
+    /**
+     * Returns <code>true</code>, if <code>H5Pset_meta_block_size</code> is available, that is, if
+     * the size of the blocks that metadata is allocated in can be set.
+     */
+    public static boolean isMetaBlockSizeAvailable()
+    {
+        return metaBlockSizeProbe.isAvailable();
+    }
+
+    /**
+     * Returns <code>true</code>, if <code>H5Pset_mdc_config</code> is available, that is, if the
+     * size of the metadata cache can be set.
+     */
+    public static boolean isMetaDataCacheConfigAvailable()
+    {
+        return metaDataCacheConfigProbe.isAvailable();
+    }
+
+}
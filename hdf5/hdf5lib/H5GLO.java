@@ -54,6 +54,11 @@ public class H5GLO
             int group_create_plist_id, int group_access_plist_id) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Gcreate(loc_id, name, link_create_plist_id, group_create_plist_id,
+                    group_access_plist_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Gcreate(loc_id, name, link_create_plist_id, group_create_plist_id,
@@ -75,6 +80,10 @@ public class H5GLO
     public static int H5Gopen(int loc_id, String name, int access_plist_id)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Gopen(loc_id, name, access_plist_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Gopen(loc_id, name, access_plist_id);
@@ -91,6 +100,10 @@ public class H5GLO
      */
     public static int H5Gclose(int group_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Gclose(group_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Gclose(group_id);
@@ -109,6 +122,10 @@ public class H5GLO
     public static int H5Gunlink(int loc_id, String name) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Gunlink(loc_id, name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Gunlink(loc_id, name);
@@ -129,6 +146,10 @@ public class H5GLO
     public static int H5Gset_comment(int loc_id, String name, String comment)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Gset_comment(loc_id, name, comment);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Gset_comment(loc_id, name, comment);
@@ -154,6 +175,10 @@ public class H5GLO
             throws ArrayIndexOutOfBoundsException, ArrayStoreException, HDF5LibraryException,
             NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Gget_comment(loc_id, name, bufsize, comment);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Gget_comment(loc_id, name, bufsize, comment);
@@ -168,6 +193,10 @@ public class H5GLO
      */
     public static long H5Gget_nlinks(int group_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Gget_nlinks(group_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Gget_nlinks(group_id);
@@ -194,6 +223,10 @@ public class H5GLO
     public static int H5Oopen(int loc_id, String name, int access_plist_id)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Oopen(loc_id, name, access_plist_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Oopen(loc_id, name, access_plist_id);
@@ -209,6 +242,10 @@ public class H5GLO
      */
     public static int H5Oclose(int loc_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Oclose(loc_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Oclose(loc_id);
@@ -235,6 +272,11 @@ public class H5GLO
             int object_copy_plist, int link_creation_plist) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Ocopy(src_loc_id, src_name, dst_loc_id, dst_name, object_copy_plist,
+                    link_creation_plist);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Ocopy(src_loc_id, src_name, dst_loc_id, dst_name, object_copy_plist,
@@ -269,6 +311,11 @@ public class H5GLO
     public static int H5Oget_info_by_name(int loc_id, String object_name, long[] infoOrNull,
             boolean exception_when_non_existent) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Oget_info_by_name(loc_id, object_name, infoOrNull,
+                    exception_when_non_existent);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Oget_info_by_name(loc_id, object_name, infoOrNull,
@@ -297,6 +344,11 @@ public class H5GLO
             String link_name, int lcpl_id, int lapl_id) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5
+                    .H5Lcreate_hard(obj_loc_id, obj_name, link_loc_id, link_name, lcpl_id, lapl_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5
@@ -317,6 +369,10 @@ public class H5GLO
     public static int H5Lcreate_soft(String target_path, int link_loc_id, String link_name,
             int lcpl_id, int lapl_id) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Lcreate_soft(target_path, link_loc_id, link_name, lcpl_id, lapl_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Lcreate_soft(target_path, link_loc_id, link_name, lcpl_id, lapl_id);
@@ -338,6 +394,11 @@ public class H5GLO
             String link_name, int lcpl_id, int lapl_id) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Lcreate_external(file_name, obj_name, link_loc_id, link_name, lcpl_id,
+                    lapl_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Lcreate_external(file_name, obj_name, link_loc_id, link_name, lcpl_id,
@@ -359,6 +420,10 @@ public class H5GLO
     public static int H5Lmove(int src_loc_id, String src_name, int dst_loc_id, String dst_name,
             int lcpl_id, int lapl_id) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Lmove(src_loc_id, src_name, dst_loc_id, dst_name, lcpl_id, lapl_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Lmove(src_loc_id, src_name, dst_loc_id, dst_name, lcpl_id, lapl_id);
@@ -376,6 +441,10 @@ public class H5GLO
     public static boolean H5Lexists(int loc_id, String name) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Lexists(loc_id, name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Lexists(loc_id, name);
@@ -391,6 +460,10 @@ public class H5GLO
     public static int H5Lget_link_info(int loc_id, String name, String[] lname,
             boolean exception_when_non_existent) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Lget_link_info(loc_id, name, lname, exception_when_non_existent);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Lget_link_info(loc_id, name, lname, exception_when_non_existent);
@@ -405,6 +478,10 @@ public class H5GLO
             final String[] oname, final int[] type, final String[] lname)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Lget_link_info_all(loc_id, name, oname, type, lname);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Lget_link_info_all(loc_id, name, oname, type, lname);
@@ -414,6 +491,10 @@ public class H5GLO
     public static int H5Lget_link_info_all(int loc_id, String name, String[] oname, int[] type,
             String[] lname, int n) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Lget_link_info_all(loc_id, name, oname, type, lname, n);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Lget_link_info_all(loc_id, name, oname, type, lname, n);
@@ -426,6 +507,10 @@ public class H5GLO
     public static int H5Lget_link_names_all(final int loc_id, final String name,
             final String[] oname) throws HDF5LibraryException, NullPointerException
             {
+                if (H5.isThreadSafe())
+                {
+                    return H5.H5Lget_link_names_all(loc_id, name, oname);
+                }
                 synchronized (ncsa.hdf.hdf5lib.H5.class)
                 {
                     return H5.H5Lget_link_names_all(loc_id, name, oname);
@@ -435,6 +520,10 @@ public class H5GLO
     public static int H5Lget_link_names_all(int loc_id, String name, String[] oname, int n)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Lget_link_names_all(loc_id, name, oname, n);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Lget_link_names_all(loc_id, name, oname, n);
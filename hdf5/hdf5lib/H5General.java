@@ -38,6 +38,17 @@ public class H5General
         H5.ensureNativeLibIsLoaded();
     }
 
+    /**
+     * Returns <code>true</code>, if calls into the native library are not serialized by the Java
+     * wrappers. This concurrent mode is switched on by setting the system property
+     * <code>jhdf5.threadsafe=true</code>. It is only switched on if the native library reports
+     * that it has been built thread-safe, see {@link H5Features#isLibraryThreadSafe()}.
+     */
+    public static boolean isThreadSafe()
+    {
+        return H5.isThreadSafe();
+    }
+
     // ////////////////////////////////////////////////////////////
     // //
     // H5: General Library Functions //
@@ -52,6 +63,10 @@ public class H5General
      */
     public static int H5open() throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5open();
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5open();
@@ -75,6 +90,10 @@ public class H5General
      */
     public static int H5get_libversion(int[] libversion) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5get_libversion(libversion);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5get_libversion(libversion);
@@ -85,6 +104,11 @@ public class H5General
             int arr_global_lim, int arr_list_lim, int blk_global_lim, int blk_list_lim)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5set_free_list_limits(reg_global_lim, reg_list_lim, arr_global_lim,
+                    arr_list_lim, blk_global_lim, blk_list_lim);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5set_free_list_limits(reg_global_lim, reg_list_lim, arr_global_lim,
@@ -94,6 +118,10 @@ public class H5General
 
     public static int H5Zfilter_avail(int filter) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Zfilter_avail(filter);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Zfilter_avail(filter);
@@ -102,6 +130,10 @@ public class H5General
 
     public static int H5Zunregister(int filter) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Zunregister(filter);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Zunregister(filter);
@@ -110,6 +142,10 @@ public class H5General
 
     public static int H5Zget_filter_info(int filter) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Zget_filter_info(filter);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Zget_filter_info(filter);
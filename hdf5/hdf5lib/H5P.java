@@ -42,6 +42,10 @@ public class H5P
      */
     public static int H5Pcreate(int type) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pcreate(type);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pcreate(type);
@@ -57,6 +61,10 @@ public class H5P
      */
     public static int H5Pclose(int plist) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pclose(plist);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pclose(plist);
@@ -73,6 +81,10 @@ public class H5P
      */
     public static int H5Pget_class(int plist) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_class(plist);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_class(plist);
@@ -88,6 +100,10 @@ public class H5P
      */
     public static int H5Pcopy(int plist) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pcopy(plist);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pcopy(plist);
@@ -116,6 +132,10 @@ public class H5P
     public static int H5Pget_version(int plist, int[] version_info) throws HDF5LibraryException,
             NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_version(plist, version_info);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_version(plist, version_info);
@@ -132,6 +152,10 @@ public class H5P
      */
     public static int H5Pset_userblock(int plist, long size) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_userblock(plist, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_userblock(plist, size);
@@ -150,6 +174,10 @@ public class H5P
     public static int H5Pget_userblock(int plist, long[] size) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_userblock(plist, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_userblock(plist, size);
@@ -168,6 +196,10 @@ public class H5P
     public static int H5Pset_small_data_block_size(int plist, long size)
             throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_small_data_block_size(plist, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_small_data_block_size(plist, size);
@@ -187,12 +219,39 @@ public class H5P
     public static int H5Pget_small_data_block_size(int plist, long[] size)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_small_data_block_size(plist, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_small_data_block_size(plist, size);
         }
     }
 
+    /**
+     * H5Pset_meta_block_size sets the minimum size of the blocks that metadata is allocated in
+     * from the file, so that the metadata of many small objects is stored close together. Needs a
+     * native library that provides this function, see
+     * {@link H5Features#isMetaBlockSizeAvailable()}.
+     * 
+     * @param fapl_id IN: Identifier of the file access property list.
+     * @param size IN: Minimum size of the metadata blocks in bytes.
+     * @return a non-negative value if successful
+     * @exception HDF5LibraryException - Error from the HDF-5 Library.
+     */
+    public static int H5Pset_meta_block_size(int fapl_id, long size) throws HDF5LibraryException
+    {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_meta_block_size(fapl_id, size);
+        }
+        synchronized (ncsa.hdf.hdf5lib.H5.class)
+        {
+            return H5.H5Pset_meta_block_size(fapl_id, size);
+        }
+    }
+
     /**
      * H5Pset_sizes sets the byte size of the offsets and lengths used to address objects in an HDF5
      * file.
@@ -206,6 +265,10 @@ public class H5P
     public static int H5Pset_sizes(int plist, int sizeof_addr, int sizeof_size)
             throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_sizes(plist, sizeof_addr, sizeof_size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_sizes(plist, sizeof_addr, sizeof_size);
@@ -233,6 +296,10 @@ public class H5P
     public static int H5Pget_sizes(int plist, int[] size) throws HDF5LibraryException,
             NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_sizes(plist, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_sizes(plist, size);
@@ -250,6 +317,10 @@ public class H5P
      */
     public static int H5Pset_sym_k(int plist, int ik, int lk) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_sym_k(plist, ik, lk);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_sym_k(plist, ik, lk);
@@ -277,6 +348,10 @@ public class H5P
     public static int H5Pget_sym_k(int plist, int[] size) throws HDF5LibraryException,
             NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_sym_k(plist, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_sym_k(plist, size);
@@ -294,6 +369,10 @@ public class H5P
      */
     public static int H5Pset_istore_k(int plist, int ik) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_istore_k(plist, ik);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_istore_k(plist, ik);
@@ -312,6 +391,10 @@ public class H5P
     public static int H5Pget_istore_k(int plist, int[] ik) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_istore_k(plist, ik);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_istore_k(plist, ik);
@@ -328,6 +411,10 @@ public class H5P
      */
     public static int H5Pset_layout(int plist, int layout) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_layout(plist, layout);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_layout(plist, layout);
@@ -344,6 +431,10 @@ public class H5P
      */
     public static int H5Pget_layout(int plist) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_layout(plist);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_layout(plist);
@@ -364,6 +455,10 @@ public class H5P
     public static int H5Pset_chunk(int plist, int ndims, byte[] dim) throws HDF5LibraryException,
             NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_chunk(plist, ndims, dim);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_chunk(plist, ndims, dim);
@@ -397,6 +492,10 @@ public class H5P
     public static int H5Pget_chunk(int plist, int max_ndims, long[] dims)
             throws HDF5LibraryException, NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_chunk(plist, max_ndims, dims);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_chunk(plist, max_ndims, dims);
@@ -417,6 +516,10 @@ public class H5P
     public static int H5Pset_alignment(int plist, long threshold, long alignment)
             throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_alignment(plist, threshold, alignment);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_alignment(plist, threshold, alignment);
@@ -444,6 +547,10 @@ public class H5P
     public static int H5Pget_alignment(int plist, long[] alignment) throws HDF5LibraryException,
             NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_alignment(plist, alignment);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_alignment(plist, alignment);
@@ -465,6 +572,10 @@ public class H5P
     public static int H5Pset_external(int plist, String name, long offset, long size)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_external(plist, name, offset, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_external(plist, name, offset, size);
@@ -480,6 +591,10 @@ public class H5P
      */
     public static int H5Pget_external_count(int plist) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_external_count(plist);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_external_count(plist);
@@ -512,6 +627,10 @@ public class H5P
             throws ArrayIndexOutOfBoundsException, ArrayStoreException, HDF5LibraryException,
             NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_external(plist, idx, name_size, name, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_external(plist, idx, name_size, name, size);
@@ -530,6 +649,10 @@ public class H5P
     public static int H5Pset_fill_value(int plist_id, int type_id, byte[] value)
             throws HDF5Exception
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_fill_value(plist_id, type_id, value);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_fill_value(plist_id, type_id, value);
@@ -548,6 +671,10 @@ public class H5P
     public static int H5Pget_fill_value(int plist_id, int type_id, byte[] value)
             throws HDF5Exception
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_fill_value(plist_id, type_id, value);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_fill_value(plist_id, type_id, value);
@@ -569,6 +696,10 @@ public class H5P
     public static int H5Pset_filter(int plist, int filter, int flags, int cd_nelmts, int[] cd_values)
             throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_filter(plist, filter, flags, cd_nelmts, cd_values);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_filter(plist, filter, flags, cd_nelmts, cd_values);
@@ -585,6 +716,10 @@ public class H5P
      */
     public static int H5Pget_nfilters(int plist) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_nfilters(plist);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_nfilters(plist);
@@ -613,6 +748,11 @@ public class H5P
             int[] cd_values, int namelen, String[] name) throws ArrayIndexOutOfBoundsException,
             ArrayStoreException, HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_filter(plist, filter_number, flags, cd_nelmts, cd_values, namelen,
+                    name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_filter(plist, filter_number, flags, cd_nelmts, cd_values, namelen,
@@ -634,12 +774,43 @@ public class H5P
     public static int H5Pset_cache(int plist, int mdc_nelmts, int rdcc_nelmts, int rdcc_nbytes,
             double rdcc_w0) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_cache(plist, mdc_nelmts, rdcc_nelmts, rdcc_nbytes, rdcc_w0);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_cache(plist, mdc_nelmts, rdcc_nelmts, rdcc_nbytes, rdcc_w0);
         }
     }
 
+    /**
+     * H5Pset_mdc_config sets the size of the metadata cache in a file access property list. The
+     * other fields of the cache configuration are kept as returned by
+     * <code>H5Pget_mdc_config</code>, with automatic resizing between <var>min_size</var> and
+     * <var>max_size</var>. Needs a native library that provides this function, see
+     * {@link H5Features#isMetaDataCacheConfigAvailable()}.
+     * 
+     * @param plist_id IN: Identifier of the file access property list.
+     * @param initial_size IN: Initial size of the metadata cache in bytes.
+     * @param min_size IN: Minimum size of the metadata cache in bytes.
+     * @param max_size IN: Maximum size of the metadata cache in bytes.
+     * @return a non-negative value if successful
+     * @exception HDF5LibraryException - Error from the HDF-5 Library.
+     */
+    public static int H5Pset_mdc_config(int plist_id, long initial_size, long min_size,
+            long max_size) throws HDF5LibraryException
+    {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_mdc_config(plist_id, initial_size, min_size, max_size);
+        }
+        synchronized (ncsa.hdf.hdf5lib.H5.class)
+        {
+            return H5.H5Pset_mdc_config(plist_id, initial_size, min_size, max_size);
+        }
+    }
+
     /**
      * Retrieves the maximum possible number of elements in the meta data cache and the maximum
      * possible number of bytes and the RDCC_W0 value in the raw data chunk cache.
@@ -655,6 +826,10 @@ public class H5P
     public static int H5Pget_cache(int plist, int[] mdc_nelmts, int[] rdcc_nelmts,
             int[] rdcc_nbytes, double[] rdcc_w0) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_cache(plist, mdc_nelmts, rdcc_nelmts, rdcc_nbytes, rdcc_w0);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_cache(plist, mdc_nelmts, rdcc_nelmts, rdcc_nbytes, rdcc_w0);
@@ -687,6 +862,10 @@ public class H5P
     public static int H5Pset_buffer(int plist, int size, byte[] tconv, byte[] bkg)
             throws HDF5LibraryException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_buffer(plist, size, tconv, bkg);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_buffer(plist, size, tconv, bkg);
@@ -707,6 +886,10 @@ public class H5P
     public static int H5Pget_buffer(int plist, byte[] tconv, byte[] bkg)
             throws HDF5LibraryException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_buffer(plist, tconv, bkg);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_buffer(plist, tconv, bkg);
@@ -725,6 +908,10 @@ public class H5P
     public static int H5Pset_preserve(int plist, boolean status) throws HDF5LibraryException,
             IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_preserve(plist, status);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_preserve(plist, status);
@@ -740,6 +927,10 @@ public class H5P
      */
     public static int H5Pget_preserve(int plist) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_preserve(plist);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_preserve(plist);
@@ -756,6 +947,10 @@ public class H5P
      */
     public static int H5Pset_deflate(int plist, int level) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_deflate(plist, level);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_deflate(plist, level);
@@ -773,6 +968,10 @@ public class H5P
      */
     public static int H5Pset_nbit(int plist) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_nbit(plist);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_nbit(plist);
@@ -797,6 +996,10 @@ public class H5P
     public static int H5Pset_scaleoffset(int plist, int scale_type, int scale_factor)
             throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_scaleoffset(plist, scale_type, scale_factor);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_scaleoffset(plist, scale_type, scale_factor);
@@ -831,6 +1034,11 @@ public class H5P
     public static void H5Pset_create_intermediate_group(int lcpl_id, boolean crt_intermed_group)
             throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            H5.H5Pset_create_intermediate_group(lcpl_id, crt_intermed_group);
+            return;
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             H5.H5Pset_create_intermediate_group(lcpl_id, crt_intermed_group);
@@ -845,6 +1053,10 @@ public class H5P
      */
     public static boolean H5Pget_create_intermediate_group(int lcpl_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_create_intermediate_group(lcpl_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_create_intermediate_group(lcpl_id);
@@ -857,6 +1069,10 @@ public class H5P
      */
     public static int H5Pcreate_xfer_abort_overflow()
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pcreate_xfer_abort_overflow();
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pcreate_xfer_abort_overflow();
@@ -869,6 +1085,10 @@ public class H5P
      */
     public static int H5Pcreate_xfer_abort()
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pcreate_xfer_abort();
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pcreate_xfer_abort();
@@ -878,6 +1098,10 @@ public class H5P
     public static int H5Pset_alloc_time(int plist_id, int alloc_time) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_alloc_time(plist_id, alloc_time);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_alloc_time(plist_id, alloc_time);
@@ -887,6 +1111,10 @@ public class H5P
     public static int H5Pget_alloc_time(int plist_id, int[] alloc_time)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_alloc_time(plist_id, alloc_time);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_alloc_time(plist_id, alloc_time);
@@ -896,6 +1124,10 @@ public class H5P
     public static int H5Pset_fill_time(int plist_id, int fill_time) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_fill_time(plist_id, fill_time);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_fill_time(plist_id, fill_time);
@@ -905,6 +1137,10 @@ public class H5P
     public static int H5Pget_fill_time(int plist_id, int[] fill_time) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_fill_time(plist_id, fill_time);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_fill_time(plist_id, fill_time);
@@ -914,6 +1150,10 @@ public class H5P
     public static int H5Pfill_value_defined(int plist_id, int[] status)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pfill_value_defined(plist_id, status);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pfill_value_defined(plist_id, status);
@@ -923,6 +1163,10 @@ public class H5P
     public static int H5Pset_fletcher32(int plist) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_fletcher32(plist);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_fletcher32(plist);
@@ -932,6 +1176,10 @@ public class H5P
     public static int H5Pset_edc_check(int plist, int check) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_edc_check(plist, check);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_edc_check(plist, check);
@@ -940,6 +1188,10 @@ public class H5P
 
     public static int H5Pget_edc_check(int plist) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_edc_check(plist);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_edc_check(plist);
@@ -949,6 +1201,10 @@ public class H5P
     public static int H5Pset_shuffle(int plist_id) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_shuffle(plist_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_shuffle(plist_id);
@@ -958,6 +1214,10 @@ public class H5P
     public static int H5Pmodify_filter(int plist, int filter, int flags, long cd_nelmts,
             int[] cd_values) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pmodify_filter(plist, filter, flags, cd_nelmts, cd_values);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pmodify_filter(plist, filter, flags, cd_nelmts, cd_values);
@@ -968,6 +1228,11 @@ public class H5P
             int[] cd_values, long namelen, String[] name) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_filter_by_id(plist_id, filter, flags, cd_nelmts, cd_values, namelen,
+                    name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_filter_by_id(plist_id, filter, flags, cd_nelmts, cd_values, namelen,
@@ -978,6 +1243,10 @@ public class H5P
     public static boolean H5Pall_filters_avail(int dcpl_id) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pall_filters_avail(dcpl_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pall_filters_avail(dcpl_id);
@@ -987,6 +1256,10 @@ public class H5P
     public static int H5Pset_hyper_vector_size(int dxpl_id, long vector_size)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_hyper_vector_size(dxpl_id, vector_size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_hyper_vector_size(dxpl_id, vector_size);
@@ -996,6 +1269,10 @@ public class H5P
     public static int H5Pget_hyper_vector_size(int dxpl_id, long[] vector_size)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_hyper_vector_size(dxpl_id, vector_size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_hyper_vector_size(dxpl_id, vector_size);
@@ -1005,6 +1282,10 @@ public class H5P
     public static int H5Pset_fclose_degree(int plist, int degree) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_fclose_degree(plist, degree);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_fclose_degree(plist, degree);
@@ -1014,6 +1295,10 @@ public class H5P
     public static int H5Pget_fclose_degree(int plist_id) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_fclose_degree(plist_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_fclose_degree(plist_id);
@@ -1023,6 +1308,10 @@ public class H5P
     public static int H5Pset_fapl_family(int fapl_id, long memb_size, int memb_fapl_id)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_fapl_family(fapl_id, memb_size, memb_fapl_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_fapl_family(fapl_id, memb_size, memb_fapl_id);
@@ -1032,6 +1321,10 @@ public class H5P
     public static int H5Pget_fapl_family(int fapl_id, long[] memb_size, int[] memb_fapl_id)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_fapl_family(fapl_id, memb_size, memb_fapl_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_fapl_family(fapl_id, memb_size, memb_fapl_id);
@@ -1041,6 +1334,10 @@ public class H5P
     public static int H5Pset_fapl_core(int fapl_id, int increment, boolean backing_store)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_fapl_core(fapl_id, increment, backing_store);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_fapl_core(fapl_id, increment, backing_store);
@@ -1050,6 +1347,10 @@ public class H5P
     public static int H5Pget_fapl_core(int fapl_id, int[] increment, boolean[] backing_store)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_fapl_core(fapl_id, increment, backing_store);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_fapl_core(fapl_id, increment, backing_store);
@@ -1059,6 +1360,10 @@ public class H5P
     public static int H5Pset_family_offset(int fapl_id, long offset) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_family_offset(fapl_id, offset);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_family_offset(fapl_id, offset);
@@ -1068,6 +1373,10 @@ public class H5P
     public static long H5Pget_family_offset(int fapl_id) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_family_offset(fapl_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_family_offset(fapl_id);
@@ -1077,6 +1386,10 @@ public class H5P
     public static int H5Pset_fapl_log(int fapl_id, String logfile, int flags, int buf_size)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_fapl_log(fapl_id, logfile, flags, buf_size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_fapl_log(fapl_id, logfile, flags, buf_size);
@@ -1085,6 +1398,10 @@ public class H5P
 
     public static int H5Premove_filter(int obj_id, int filter) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Premove_filter(obj_id, filter);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Premove_filter(obj_id, filter);
@@ -1100,6 +1417,10 @@ public class H5P
      */
     public static int H5Pcreate_list(int cls) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pcreate_list(cls);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pcreate_list(cls);
@@ -1117,6 +1438,10 @@ public class H5P
      */
     public static int H5Pset(int plid, String name, int value) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset(plid, name, value);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset(plid, name, value);
@@ -1134,6 +1459,10 @@ public class H5P
      */
     public static int H5Pexist(int plid, String name) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pexist(plid, name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pexist(plid, name);
@@ -1150,6 +1479,10 @@ public class H5P
      */
     public static long H5Pget_size(int plid, String name) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_size(plid, name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_size(plid, name);
@@ -1165,6 +1498,10 @@ public class H5P
      */
     public static long H5Pget_nprops(int plid) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_nprops(plid);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_nprops(plid);
@@ -1180,6 +1517,10 @@ public class H5P
      */
     public static String H5Pget_class_name(int plid) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_class_name(plid);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_class_name(plid);
@@ -1195,6 +1536,10 @@ public class H5P
      */
     public static int H5Pget_class_parent(int plid) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_class_parent(plid);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_class_parent(plid);
@@ -1211,6 +1556,10 @@ public class H5P
      */
     public static int H5Pisa_class(int plist, int pclass) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pisa_class(plist, pclass);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pisa_class(plist, pclass);
@@ -1227,6 +1576,10 @@ public class H5P
      */
     public static int H5Pget(int plid, String name) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget(plid, name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget(plid, name);
@@ -1243,6 +1596,10 @@ public class H5P
      */
     public static int H5Pequal(int plid1, int plid2) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pequal(plid1, plid2);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pequal(plid1, plid2);
@@ -1260,6 +1617,10 @@ public class H5P
      */
     public static int H5Pcopy_prop(int dst_id, int src_id, String name) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pcopy_prop(dst_id, src_id, name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pcopy_prop(dst_id, src_id, name);
@@ -1276,6 +1637,10 @@ public class H5P
      */
     public static int H5Premove(int plid, String name) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Premove(plid, name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Premove(plid, name);
@@ -1292,6 +1657,10 @@ public class H5P
      */
     public static int H5Punregister(int plid, String name) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Punregister(plid, name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Punregister(plid, name);
@@ -1307,6 +1676,10 @@ public class H5P
      */
     public static int H5Pclose_class(int plid) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pclose_class(plid);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pclose_class(plid);
@@ -1333,6 +1706,10 @@ public class H5P
     public static int H5Pset_libver_bounds(int plist_id, int low, int high)
             throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_libver_bounds(plist_id, low, high);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_libver_bounds(plist_id, low, high);
@@ -1347,12 +1724,41 @@ public class H5P
      */
     public static int[] H5Pget_libver_bounds(int plist_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_libver_bounds(plist_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_libver_bounds(plist_id);
         }
     }
 
+    /**
+     * Sets the raw data chunk cache parameters of a dataset access property list. Overrides the
+     * file-level defaults set with {@link #H5Pset_cache(int, int, int, int, double)} for datasets
+     * opened with this property list. Not every build of the native library provides this
+     * function, see {@link H5Features#isDataSetChunkCacheAvailable()}.
+     * 
+     * @param dapl_id Dataset access property list identifier.
+     * @param rdcc_nslots The number of chunk slots in the raw data chunk cache hash table.
+     * @param rdcc_nbytes The total size of the raw data chunk cache, in bytes.
+     * @param rdcc_w0 The chunk preemption policy.
+     * @return a non-negative value if successful
+     */
+    public static int H5Pset_chunk_cache(int dapl_id, long rdcc_nslots, long rdcc_nbytes,
+            double rdcc_w0) throws HDF5LibraryException
+    {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_chunk_cache(dapl_id, rdcc_nslots, rdcc_nbytes, rdcc_w0);
+        }
+        synchronized (ncsa.hdf.hdf5lib.H5.class)
+        {
+            return H5.H5Pset_chunk_cache(dapl_id, rdcc_nslots, rdcc_nbytes, rdcc_w0);
+        }
+    }
+
     /**
      * Sets the local heap size hint for an old-style group. This is the chunk size allocated on the
      * heap for a group.
@@ -1363,6 +1769,10 @@ public class H5P
      */
     public static int H5Pset_local_heap_size_hint(int gcpl_id, int size_hint)
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_local_heap_size_hint(gcpl_id, size_hint);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_local_heap_size_hint(gcpl_id, size_hint);
@@ -1378,6 +1788,10 @@ public class H5P
      */
     public static int H5Pget_local_heap_size_hint(int gcpl_id)
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_local_heap_size_hint(gcpl_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_local_heap_size_hint(gcpl_id);
@@ -1394,6 +1808,10 @@ public class H5P
      */
     public static int H5Pset_link_phase_change(int gcpl_id, int max_compact, int min_dense)
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_link_phase_change(gcpl_id, max_compact, min_dense);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_link_phase_change(gcpl_id, max_compact, min_dense);
@@ -1408,6 +1826,10 @@ public class H5P
      */
     public static int[] H5Pget_link_phase_change(int gcpl_id)
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_link_phase_change(gcpl_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_link_phase_change(gcpl_id);
@@ -1424,6 +1846,10 @@ public class H5P
      */
     public static int H5Pset_char_encoding(int cpl_id, int encoding)
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pset_char_encoding(cpl_id, encoding);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pset_char_encoding(cpl_id, encoding);
@@ -1439,6 +1865,10 @@ public class H5P
      */
     public static int H5Pget_char_encoding(int cpl_id)
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Pget_char_encoding(cpl_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Pget_char_encoding(cpl_id);
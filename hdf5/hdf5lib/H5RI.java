@@ -55,6 +55,10 @@ public class H5RI
             final int space_id) throws HDF5LibraryException, NullPointerException,
             IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Rcreate(loc_id, name, ref_type, space_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Rcreate(loc_id, name, ref_type, space_id);
@@ -74,6 +78,10 @@ public class H5RI
     public static long[] H5Rcreate(final int loc_id, final String[] name)
             throws HDF5LibraryException, NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Rcreate(loc_id, name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Rcreate(loc_id, name);
@@ -93,6 +101,10 @@ public class H5RI
     public static int H5Rdereference(int loc_id, long ref)
             throws HDF5LibraryException, NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Rdereference(loc_id, ref);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Rdereference(loc_id, ref);
@@ -113,6 +125,10 @@ public class H5RI
     public static int H5Rdereference(int loc_id, int ref_type, byte[] ref)
             throws HDF5LibraryException, NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Rdereference(loc_id, ref_type, ref);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Rdereference(loc_id, ref_type, ref);
@@ -134,6 +150,10 @@ public class H5RI
     public static int H5Rget_region(int loc_id, int ref_type, byte[] ref)
             throws HDF5LibraryException, NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Rget_region(loc_id, ref_type, ref);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Rget_region(loc_id, ref_type, ref);
@@ -155,6 +175,10 @@ public class H5RI
     public static int H5Rget_obj_type(int loc_id, int ref_type, byte[] ref)
             throws HDF5LibraryException, NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Rget_obj_type(loc_id, ref_type, ref);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Rget_obj_type(loc_id, ref_type, ref);
@@ -175,6 +199,10 @@ public class H5RI
      */
     public static String H5Rget_name(int loc_id, int ref_type, byte[] ref)
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Rget_name(loc_id, ref_type, ref);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Rget_name(loc_id, ref_type, ref);
@@ -195,6 +223,10 @@ public class H5RI
     public static String H5Rget_name(int loc_id, long ref)
             throws HDF5LibraryException, NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Rget_name(loc_id, ref);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Rget_name(loc_id, ref);
@@ -215,6 +247,10 @@ public class H5RI
      */
     public static String[] H5Rget_name(int loc_id, long[] ref)
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Rget_name(loc_id, ref);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Rget_name(loc_id, ref);
@@ -236,6 +272,10 @@ public class H5RI
      */
     public static int H5Iget_type(int obj_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Iget_type(obj_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Iget_type(obj_id);
@@ -245,6 +285,10 @@ public class H5RI
     public static long H5Iget_name(int obj_id, String[] name, long size)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Iget_name(obj_id, name, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Iget_name(obj_id, name, size);
@@ -253,6 +297,10 @@ public class H5RI
 
     public static int H5Iget_ref(int obj_id) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Iget_ref(obj_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Iget_ref(obj_id);
@@ -261,6 +309,10 @@ public class H5RI
 
     public static int H5Iinc_ref(int obj_id) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Iinc_ref(obj_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Iinc_ref(obj_id);
@@ -269,6 +321,10 @@ public class H5RI
 
     public static int H5Idec_ref(int obj_id) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Idec_ref(obj_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Idec_ref(obj_id);
@@ -277,6 +333,10 @@ public class H5RI
 
     public static int H5Iget_file_id(int obj_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Iget_file_id(obj_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Iget_file_id(obj_id);
@@ -42,6 +42,10 @@ public class H5S
      */
     public static int H5Screate(int type) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Screate(type);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Screate(type);
@@ -61,6 +65,10 @@ public class H5S
     public static int H5Screate_simple(int rank, byte[] dims, byte[] maxdims)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Screate_simple(rank, dims, maxdims);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Screate_simple(rank, dims, maxdims);
@@ -70,6 +78,10 @@ public class H5S
     public static int H5Screate_simple(final int rank, final long[] dims, final long[] maxdims)
             throws HDF5Exception, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Screate_simple(rank, dims, maxdims);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Screate_simple(rank, dims, maxdims);
@@ -86,6 +98,10 @@ public class H5S
      */
     public static int H5Scopy(int space_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Scopy(space_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Scopy(space_id);
@@ -106,6 +122,10 @@ public class H5S
     public static int H5Sselect_elements(int space_id, int op, int num_elements, byte[] coord)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sselect_elements(space_id, op, num_elements, coord);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sselect_elements(space_id, op, num_elements, coord);
@@ -121,6 +141,10 @@ public class H5S
      */
     public static int H5Sselect_all(int space_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sselect_all(space_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sselect_all(space_id);
@@ -136,6 +160,10 @@ public class H5S
      */
     public static int H5Sselect_none(int space_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sselect_none(space_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sselect_none(space_id);
@@ -152,6 +180,10 @@ public class H5S
      */
     public static boolean H5Sselect_valid(int space_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sselect_valid(space_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sselect_valid(space_id);
@@ -167,6 +199,10 @@ public class H5S
      */
     public static long H5Sget_simple_extent_npoints(int space_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sget_simple_extent_npoints(space_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sget_simple_extent_npoints(space_id);
@@ -183,6 +219,10 @@ public class H5S
      */
     public static long H5Sget_select_npoints(int space_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sget_select_npoints(space_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sget_select_npoints(space_id);
@@ -198,6 +238,10 @@ public class H5S
      */
     public static int H5Sget_simple_extent_ndims(int space_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sget_simple_extent_ndims(space_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sget_simple_extent_ndims(space_id);
@@ -218,6 +262,10 @@ public class H5S
     public static int H5Sget_simple_extent_dims(int space_id, long[] dims, long[] maxdims)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sget_simple_extent_dims(space_id, dims, maxdims);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sget_simple_extent_dims(space_id, dims, maxdims);
@@ -233,6 +281,10 @@ public class H5S
      */
     public static int H5Sget_simple_extent_type(int space_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sget_simple_extent_type(space_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sget_simple_extent_type(space_id);
@@ -252,6 +304,10 @@ public class H5S
     public static int H5Sset_extent_simple(int space_id, int rank, byte[] current_size,
             byte[] maximum_size) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sset_extent_simple(space_id, rank, current_size, maximum_size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sset_extent_simple(space_id, rank, current_size, maximum_size);
@@ -262,6 +318,10 @@ public class H5S
             final long[] currentSize, final long[] maxSize) throws HDF5Exception,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sset_extent_simple(space_id, rank, currentSize, maxSize);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sset_extent_simple(space_id, rank, currentSize, maxSize);
@@ -277,6 +337,10 @@ public class H5S
      */
     public static boolean H5Sis_simple(int space_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sis_simple(space_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sis_simple(space_id);
@@ -295,6 +359,10 @@ public class H5S
     public static int H5Soffset_simple(int space_id, byte[] offset) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Soffset_simple(space_id, offset);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Soffset_simple(space_id, offset);
@@ -304,6 +372,10 @@ public class H5S
     public static int H5Soffset_simple(final int space_id, final long[] offset)
             throws HDF5Exception, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Soffset_simple(space_id, offset);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Soffset_simple(space_id, offset);
@@ -322,6 +394,10 @@ public class H5S
     public static int H5Sextent_copy(int dest_space_id, int source_space_id)
             throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sextent_copy(dest_space_id, source_space_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sextent_copy(dest_space_id, source_space_id);
@@ -337,6 +413,10 @@ public class H5S
      */
     public static int H5Sset_extent_none(int space_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sset_extent_none(space_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sset_extent_none(space_id);
@@ -363,6 +443,10 @@ public class H5S
             byte[] count, byte[] block) throws HDF5LibraryException, NullPointerException,
             IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sselect_hyperslab(space_id, op, start, stride, count, block);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sselect_hyperslab(space_id, op, start, stride, count, block);
@@ -373,6 +457,10 @@ public class H5S
             final long[] stride, final long[] count, final long[] block) throws HDF5Exception,
             NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sselect_hyperslab(space_id, op, start, stride, count, block);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sselect_hyperslab(space_id, op, start, stride, count, block);
@@ -388,6 +476,10 @@ public class H5S
      */
     public static int H5Sclose(int space_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sclose(space_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sclose(space_id);
@@ -404,6 +496,10 @@ public class H5S
      */
     public static long H5Sget_select_hyper_nblocks(int spaceid) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sget_select_hyper_nblocks(spaceid);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sget_select_hyper_nblocks(spaceid);
@@ -420,6 +516,10 @@ public class H5S
      */
     public static long H5Sget_select_elem_npoints(int spaceid) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sget_select_elem_npoints(spaceid);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sget_select_elem_npoints(spaceid);
@@ -451,6 +551,10 @@ public class H5S
     public static int H5Sget_select_hyper_blocklist(int spaceid, long startblock, long numblocks,
             long[] buf) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sget_select_hyper_blocklist(spaceid, startblock, numblocks, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sget_select_hyper_blocklist(spaceid, startblock, numblocks, buf);
@@ -473,6 +577,10 @@ public class H5S
     public static int H5Sget_select_elem_pointlist(int spaceid, long startpoint, long numpoints,
             long[] buf) throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sget_select_elem_pointlist(spaceid, startpoint, numpoints, buf);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sget_select_elem_pointlist(spaceid, startpoint, numpoints, buf);
@@ -496,6 +604,10 @@ public class H5S
     public static int H5Sget_select_bounds(int spaceid, long[] start, long[] end)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Sget_select_bounds(spaceid, start, end);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Sget_select_bounds(spaceid, start, end);
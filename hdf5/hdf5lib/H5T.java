@@ -46,6 +46,10 @@ public class H5T
     public static int H5Topen(int loc_id, String name, int access_plist_id)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Topen(loc_id, name, access_plist_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Topen(loc_id, name, access_plist_id);
@@ -70,6 +74,11 @@ public class H5T
             int dtype_create_plist_id, int dtype_access_plist_id) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tcommit(loc_id, name, type_id, link_create_plist_id, dtype_create_plist_id,
+                    dtype_access_plist_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tcommit(loc_id, name, type_id, link_create_plist_id, dtype_create_plist_id,
@@ -87,6 +96,10 @@ public class H5T
      */
     public static boolean H5Tcommitted(int type) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tcommitted(type);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tcommitted(type);
@@ -103,6 +116,10 @@ public class H5T
      */
     public static int H5Tcreate(int dclass, int size) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tcreate(dclass, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tcreate(dclass, size);
@@ -119,6 +136,10 @@ public class H5T
      */
     public static int H5Tcopy(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tcopy(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tcopy(type_id);
@@ -135,6 +156,10 @@ public class H5T
      */
     public static boolean H5Tequal(int type_id1, int type_id2) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tequal(type_id1, type_id2);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tequal(type_id1, type_id2);
@@ -151,6 +176,10 @@ public class H5T
      */
     public static int H5Tlock(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tlock(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tlock(type_id);
@@ -166,6 +195,10 @@ public class H5T
      */
     public static int H5Tget_class(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_class(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_class(type_id);
@@ -182,6 +215,10 @@ public class H5T
      */
     public static int H5Tget_size(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_size(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_size(type_id);
@@ -197,6 +234,10 @@ public class H5T
      */
     public static long H5Tget_size_long(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_size_long(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_size_long(type_id);
@@ -214,6 +255,10 @@ public class H5T
      */
     public static int H5Tset_size(int type_id, int size) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tset_size(type_id, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tset_size(type_id, size);
@@ -229,6 +274,10 @@ public class H5T
      */
     public static int H5Tget_order(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_order(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_order(type_id);
@@ -245,6 +294,10 @@ public class H5T
      */
     public static int H5Tset_order(int type_id, int order) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tset_order(type_id, order);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tset_order(type_id, order);
@@ -260,6 +313,10 @@ public class H5T
      */
     public static int H5Tget_precision(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_precision(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_precision(type_id);
@@ -276,6 +333,10 @@ public class H5T
      */
     public static int H5Tset_precision(int type_id, int precision) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tset_precision(type_id, precision);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tset_precision(type_id, precision);
@@ -291,6 +352,10 @@ public class H5T
      */
     public static int H5Tget_offset(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_offset(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_offset(type_id);
@@ -307,6 +372,10 @@ public class H5T
      */
     public static int H5Tset_offset(int type_id, int offset) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tset_offset(type_id, offset);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tset_offset(type_id, offset);
@@ -332,6 +401,10 @@ public class H5T
     public static int H5Tget_pad(int type_id, int[] pad) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_pad(type_id, pad);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_pad(type_id, pad);
@@ -349,6 +422,10 @@ public class H5T
      */
     public static int H5Tset_pad(int type_id, int lsb, int msb) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tset_pad(type_id, lsb, msb);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tset_pad(type_id, lsb, msb);
@@ -364,6 +441,10 @@ public class H5T
      */
     public static int H5Tget_sign(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_sign(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_sign(type_id);
@@ -380,6 +461,10 @@ public class H5T
      */
     public static int H5Tset_sign(int type_id, int sign) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tset_sign(type_id, sign);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tset_sign(type_id, sign);
@@ -409,6 +494,10 @@ public class H5T
     public static int H5Tget_fields(int type_id, int[] fields) throws HDF5LibraryException,
             NullPointerException, IllegalArgumentException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_fields(type_id, fields);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_fields(type_id, fields);
@@ -430,6 +519,10 @@ public class H5T
     public static int H5Tset_fields(int type_id, int spos, int epos, int esize, int mpos, int msize)
             throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tset_fields(type_id, spos, epos, esize, mpos, msize);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tset_fields(type_id, spos, epos, esize, mpos, msize);
@@ -445,6 +538,10 @@ public class H5T
      */
     public static int H5Tget_ebias(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_ebias(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_ebias(type_id);
@@ -461,6 +558,10 @@ public class H5T
      */
     public static int H5Tset_ebias(int type_id, int ebias) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tset_ebias(type_id, ebias);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tset_ebias(type_id, ebias);
@@ -476,6 +577,10 @@ public class H5T
      */
     public static int H5Tget_norm(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_norm(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_norm(type_id);
@@ -492,6 +597,10 @@ public class H5T
      */
     public static int H5Tset_norm(int type_id, int norm) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tset_norm(type_id, norm);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tset_norm(type_id, norm);
@@ -507,6 +616,10 @@ public class H5T
      */
     public static int H5Tget_inpad(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_inpad(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_inpad(type_id);
@@ -525,6 +638,10 @@ public class H5T
      */
     public static int H5Tset_inpad(int type_id, int inpad) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tset_inpad(type_id, inpad);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tset_inpad(type_id, inpad);
@@ -540,6 +657,10 @@ public class H5T
      */
     public static int H5Tget_cset(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_cset(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_cset(type_id);
@@ -556,6 +677,10 @@ public class H5T
      */
     public static int H5Tset_cset(int type_id, int cset) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tset_cset(type_id, cset);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tset_cset(type_id, cset);
@@ -571,6 +696,10 @@ public class H5T
      */
     public static int H5Tget_strpad(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_strpad(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_strpad(type_id);
@@ -587,6 +716,10 @@ public class H5T
      */
     public static int H5Tset_strpad(int type_id, int strpad) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tset_strpad(type_id, strpad);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tset_strpad(type_id, strpad);
@@ -602,6 +735,10 @@ public class H5T
      */
     public static int H5Tget_nmembers(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_nmembers(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_nmembers(type_id);
@@ -617,6 +754,10 @@ public class H5T
      */
     public static String H5Tget_member_name(int type_id, int field_idx)
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_member_name(type_id, field_idx);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_member_name(type_id, field_idx);
@@ -632,6 +773,10 @@ public class H5T
      */
     public static int H5Tget_member_index(int type_id, String field_name)
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_member_index(type_id, field_name);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_member_index(type_id, field_name);
@@ -648,6 +793,10 @@ public class H5T
      */
     public static int H5Tget_member_class(int type_id, int field_idx) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_member_class(type_id, field_idx);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_member_class(type_id, field_idx);
@@ -664,6 +813,10 @@ public class H5T
      */
     public static int H5Tget_member_type(int type_id, int field_idx) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_member_type(type_id, field_idx);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_member_type(type_id, field_idx);
@@ -682,6 +835,10 @@ public class H5T
      */
     public static long H5Tget_member_offset(int type_id, int membno) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_member_offset(type_id, membno);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_member_offset(type_id, membno);
@@ -702,6 +859,10 @@ public class H5T
     public static int H5Tinsert(int type_id, String name, long offset, int field_id)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tinsert(type_id, name, offset, field_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tinsert(type_id, name, offset, field_id);
@@ -721,6 +882,10 @@ public class H5T
      */
     public static int H5Tpack(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tpack(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tpack(type_id);
@@ -736,6 +901,10 @@ public class H5T
      */
     public static int H5Tclose(int type_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tclose(type_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tclose(type_id);
@@ -752,6 +921,10 @@ public class H5T
      */
     public static int H5Tenum_create(int base_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tenum_create(base_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tenum_create(base_id);
@@ -771,6 +944,10 @@ public class H5T
     public static int H5Tenum_insert(int type, String name, byte value)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tenum_insert(type, name, value);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tenum_insert(type, name, value);
@@ -790,6 +967,10 @@ public class H5T
     public static int H5Tenum_insert(int type, String name, short value)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tenum_insert(type, name, value);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tenum_insert(type, name, value);
@@ -809,6 +990,10 @@ public class H5T
     public static int H5Tenum_insert(int type, String name, int value) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tenum_insert(type, name, value);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tenum_insert(type, name, value);
@@ -823,6 +1008,10 @@ public class H5T
     public static int H5Tconvert_to_little_endian(short[] value)
 
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tconvert_to_little_endian(value);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tconvert_to_little_endian(value);
@@ -836,6 +1025,10 @@ public class H5T
      */
     public static int H5Tconvert_to_little_endian(int[] value)
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tconvert_to_little_endian(value);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tconvert_to_little_endian(value);
@@ -857,6 +1050,10 @@ public class H5T
     public static int H5Tenum_nameof(int type, int[] value, String[] name, int size)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tenum_nameof(type, value, name, size);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tenum_nameof(type, value, name, size);
@@ -877,6 +1074,10 @@ public class H5T
     public static int H5Tenum_valueof(int type, String name, int[] value)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tenum_valueof(type, name, value);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tenum_valueof(type, name, value);
@@ -892,6 +1093,10 @@ public class H5T
      */
     public static int H5Tvlen_create(int base_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tvlen_create(base_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tvlen_create(base_id);
@@ -908,6 +1113,10 @@ public class H5T
      */
     public static int H5Tset_tag(int type, String tag) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tset_tag(type, tag);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tset_tag(type, tag);
@@ -923,6 +1132,10 @@ public class H5T
      */
     public static String H5Tget_tag(int type) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_tag(type);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_tag(type);
@@ -938,6 +1151,10 @@ public class H5T
      */
     public static int H5Tget_super(int type) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_super(type);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_super(type);
@@ -957,6 +1174,10 @@ public class H5T
     public static int H5Tget_member_value(int type_id, int membno, int[] value)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_member_value(type_id, membno, value);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_member_value(type_id, membno, value);
@@ -976,6 +1197,10 @@ public class H5T
     public static int H5Tarray_create(int base_type_id, int rank, int[] dims)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tarray_create(base_type_id, rank, dims);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tarray_create(base_type_id, rank, dims);
@@ -991,6 +1216,10 @@ public class H5T
      */
     public static int H5Tget_array_ndims(int adtype_id) throws HDF5LibraryException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_array_ndims(adtype_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_array_ndims(adtype_id);
@@ -1010,6 +1239,10 @@ public class H5T
     public static int H5Tget_array_dims(int adtype_id, int[] dims) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_array_dims(adtype_id, dims);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_array_dims(adtype_id, dims);
@@ -1019,6 +1252,10 @@ public class H5T
     public static int H5Tget_native_type(int tid, int alloc_time) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_native_type(tid, alloc_time);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_native_type(tid, alloc_time);
@@ -1028,6 +1265,10 @@ public class H5T
     public static int H5Tget_native_type(final int tid) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tget_native_type(tid);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tget_native_type(tid);
@@ -1037,6 +1278,10 @@ public class H5T
     public static boolean H5Tis_variable_str(int dtype_id) throws HDF5LibraryException,
             NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tis_variable_str(dtype_id);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tis_variable_str(dtype_id);
@@ -1046,6 +1291,10 @@ public class H5T
     public static boolean H5Tdetect_class(int dtype_id, int dtype_class)
             throws HDF5LibraryException, NullPointerException
     {
+        if (H5.isThreadSafe())
+        {
+            return H5.H5Tdetect_class(dtype_id, dtype_class);
+        }
         synchronized (ncsa.hdf.hdf5lib.H5.class)
         {
             return H5.H5Tdetect_class(dtype_id, dtype_class);
@@ -24,6 +24,9 @@ public class HDFNativeData
 {
 
     static final int pointerSize;
+
+    private static final boolean NATIVE_IS_LITTLE_ENDIAN =
+            java.nio.ByteOrder.nativeOrder() == java.nio.ByteOrder.LITTLE_ENDIAN;
     
     static
     {
@@ -99,6 +102,185 @@ public class HDFNativeData
         return NativeData.doubleToByte(new double[] { data }, ByteOrder.NATIVE); 
     }
 
+    /**
+     * Copies a <code>short</code> value into <var>byteArr</var>, starting at <var>start</var>.
+     * 
+     * @param data The value to convert.
+     * @param byteArr The array to copy the value into.
+     * @param start The position in the <var>byteArr</var> to copy the value to.
+     */
+    public static void shortToByte(short data, byte[] byteArr, int start)
+    {
+        copyBitsToByte(data, 2, byteArr, start);
+    }
+
+    /**
+     * Copies an <code>int</code> value into <var>byteArr</var>, starting at <var>start</var>.
+     * 
+     * @param data The value to convert.
+     * @param byteArr The array to copy the value into.
+     * @param start The position in the <var>byteArr</var> to copy the value to.
+     */
+    public static void intToByte(int data, byte[] byteArr, int start)
+    {
+        copyBitsToByte(data, 4, byteArr, start);
+    }
+
+    /**
+     * Copies a <code>long</code> value into <var>byteArr</var>, starting at <var>start</var>.
+     * 
+     * @param data The value to convert.
+     * @param byteArr The array to copy the value into.
+     * @param start The position in the <var>byteArr</var> to copy the value to.
+     */
+    public static void longToByte(long data, byte[] byteArr, int start)
+    {
+        copyBitsToByte(data, 8, byteArr, start);
+    }
+
+    /**
+     * Copies a <code>float</code> value into <var>byteArr</var>, starting at <var>start</var>.
+     * 
+     * @param data The value to convert.
+     * @param byteArr The array to copy the value into.
+     * @param start The position in the <var>byteArr</var> to copy the value to.
+     */
+    public static void floatToByte(float data, byte[] byteArr, int start)
+    {
+        copyBitsToByte(Float.floatToRawIntBits(data), 4, byteArr, start);
+    }
+
+    /**
+     * Copies a <code>double</code> value into <var>byteArr</var>, starting at <var>start</var>.
+     * 
+     * @param data The value to convert.
+     * @param byteArr The array to copy the value into.
+     * @param start The position in the <var>byteArr</var> to copy the value to.
+     */
+    public static void doubleToByte(double data, byte[] byteArr, int start)
+    {
+        copyBitsToByte(Double.doubleToRawLongBits(data), 8, byteArr, start);
+    }
+
+    /**
+     * Copies a <code>short[]</code> array into <var>byteArr</var>, starting at <var>start</var>.
+     * 
+     * @param data The array to convert.
+     * @param byteArr The array to copy the values into.
+     * @param start The position in the <var>byteArr</var> to copy the first value to.
+     */
+    public static void shortToByte(short[] data, byte[] byteArr, int start)
+    {
+        for (int i = 0; i < data.length; ++i)
+        {
+            copyBitsToByte(data[i], 2, byteArr, start + 2 * i);
+        }
+    }
+
+    /**
+     * Copies an <code>int[]</code> array into <var>byteArr</var>, starting at <var>start</var>.
+     * 
+     * @param data The array to convert.
+     * @param byteArr The array to copy the values into.
+     * @param start The position in the <var>byteArr</var> to copy the first value to.
+     */
+    public static void intToByte(int[] data, byte[] byteArr, int start)
+    {
+        for (int i = 0; i < data.length; ++i)
+        {
+            copyBitsToByte(data[i], 4, byteArr, start + 4 * i);
+        }
+    }
+
+    /**
+     * Copies a <code>long[]</code> array into <var>byteArr</var>, starting at <var>start</var>.
+     * 
+     * @param data The array to convert.
+     * @param byteArr The array to copy the values into.
+     * @param start The position in the <var>byteArr</var> to copy the first value to.
+     */
+    public static void longToByte(long[] data, byte[] byteArr, int start)
+    {
+        for (int i = 0; i < data.length; ++i)
+        {
+            copyBitsToByte(data[i], 8, byteArr, start + 8 * i);
+        }
+    }
+
+    /**
+     * Copies a <code>float[]</code> array into <var>byteArr</var>, starting at <var>start</var>.
+     * 
+     * @param data The array to convert.
+     * @param byteArr The array to copy the values into.
+     * @param start The position in the <var>byteArr</var> to copy the first value to.
+     */
+    public static void floatToByte(float[] data, byte[] byteArr, int start)
+    {
+        for (int i = 0; i < data.length; ++i)
+        {
+            copyBitsToByte(Float.floatToRawIntBits(data[i]), 4, byteArr, start + 4 * i);
+        }
+    }
+
+    /**
+     * Copies a <code>double[]</code> array into <var>byteArr</var>, starting at <var>start</var>.
+     * 
+     * @param data The array to convert.
+     * @param byteArr The array to copy the values into.
+     * @param start The position in the <var>byteArr</var> to copy the first value to.
+     */
+    public static void doubleToByte(double[] data, byte[] byteArr, int start)
+    {
+        for (int i = 0; i < data.length; ++i)
+        {
+            copyBitsToByte(Double.doubleToRawLongBits(data[i]), 8, byteArr, start + 8 * i);
+        }
+    }
+
+    /**
+     * Copies the lower <var>size</var> bytes of <var>bits</var> into <var>byteArr</var> in native
+     * byte order. Done in Java as for single values the JNI call and the temporary arrays of
+     * {@link NativeData} cost more than the conversion itself.
+     */
+    private static void copyBitsToByte(long bits, int size, byte[] byteArr, int start)
+    {
+        if (NATIVE_IS_LITTLE_ENDIAN)
+        {
+            for (int i = 0; i < size; ++i)
+            {
+                byteArr[start + i] = (byte) (bits >>> (8 * i));
+            }
+        } else
+        {
+            for (int i = 0; i < size; ++i)
+            {
+                byteArr[start + size - 1 - i] = (byte) (bits >>> (8 * i));
+            }
+        }
+    }
+
+    /**
+     * Reads <var>size</var> bytes in native byte order from <var>byteArr</var>.
+     */
+    private static long copyByteToBits(byte[] byteArr, int start, int size)
+    {
+        long bits = 0;
+        if (NATIVE_IS_LITTLE_ENDIAN)
+        {
+            for (int i = size - 1; i >= 0; --i)
+            {
+                bits = (bits << 8) | (byteArr[start + i] & 0xff);
+            }
+        } else
+        {
+            for (int i = 0; i < size; ++i)
+            {
+                bits = (bits << 8) | (byteArr[start + i] & 0xff);
+            }
+        }
+        return bits;
+    }
+
     /**
      * Converts a range of a <code>byte[]</code> to a <code>short</code> value.
      * 
@@ -108,7 +290,7 @@ public class HDFNativeData
      */
     public static short byteToShort(byte[] byteArr, int start)
     {
-        return NativeData.byteToShort(byteArr, ByteOrder.NATIVE, start, 1)[0];
+        return (short) copyByteToBits(byteArr, start, 2);
     }
 
     /**
@@ -133,7 +315,7 @@ public class HDFNativeData
      */
     public static int byteToInt(byte[] byteArr, int start)
     {
-        return NativeData.byteToInt(byteArr, ByteOrder.NATIVE, start, 1)[0];
+        return (int) copyByteToBits(byteArr, start, 4);
     }
 
     /**
@@ -158,7 +340,7 @@ public class HDFNativeData
      */
     public static long byteToLong(byte[] byteArr, int start)
     {
-        return NativeData.byteToLong(byteArr, ByteOrder.NATIVE, start, 1)[0];
+        return copyByteToBits(byteArr, start, 8);
     }
 
     /**
@@ -183,7 +365,7 @@ public class HDFNativeData
      */
     public static float byteToFloat(byte[] byteArr, int start)
     {
-        return NativeData.byteToFloat(byteArr, ByteOrder.NATIVE, start, 1)[0];
+        return Float.intBitsToFloat((int) copyByteToBits(byteArr, start, 4));
     }
 
     /**
@@ -208,7 +390,7 @@ public class HDFNativeData
      */
     public static double byteToDouble(byte[] byteArr, int start)
     {
-        return NativeData.byteToDouble(byteArr, ByteOrder.NATIVE, start, 1)[0];
+        return Double.longBitsToDouble(copyByteToBits(byteArr, start, 8));
     }
 
     /**